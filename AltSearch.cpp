@@ -0,0 +1,91 @@
+#include "AltSearch.h"
+#include <algorithm>
+
+AltSearch::AltSearch(const Graph& graph, const LandmarkIndex& landmarks)
+    : graph(graph), landmarks(landmarks), heap(graph.getCurrentNodeCount())
+{
+    this->settledNodeCount = 0;
+}
+
+int AltSearch::findShortestPath(int source, int destination, std::vector<int>& nodes)
+{
+    landmarks.checkVersion();
+    const CsrGraph& adjacency = graph.freeze();
+
+    nodes.clear();
+    settledNodeCount = 0;
+    workspace.prepare(graph.getCurrentNodeCount());
+    heap.clear();
+
+    int sourceBound = landmarks.getLowerBound(source, destination);
+    if (sourceBound == INT_MAX)
+    {
+        return INT_MAX;
+    }
+
+    workspace.setCost(source, 0, -1);
+    heap.insert(source, sourceBound);
+
+    while (!heap.isEmpty())
+    {
+        int minimumNodeValue = heap.extractMinimum();
+        settledNodeCount++;
+
+        if (minimumNodeValue == destination)
+        {
+            break;
+        }
+
+        int minimumNodeCost = workspace.getCost(minimumNodeValue);
+
+        int edgeEnd = adjacency.getEdgeEnd(minimumNodeValue);
+        for (int edge = adjacency.getEdgeBegin(minimumNodeValue); edge < edgeEnd; ++edge)
+        {
+            int value = adjacency.getTarget(edge);
+            int newCost = adjacency.getWeight(edge) + minimumNodeCost;
+
+            if (heap.wasExtracted(value) || newCost >= workspace.getCost(value))
+            {
+                continue;
+            }
+
+            // Nodes, from which the landmarks prove the destination unreachable, are never queued
+            int bound = landmarks.getLowerBound(value, destination);
+            if (bound == INT_MAX)
+            {
+                continue;
+            }
+
+            workspace.setCost(value, newCost, minimumNodeValue);
+
+            long long priority = static_cast<long long>(newCost) + bound;
+            if (heap.doesNodeExist(value))
+            {
+                heap.decreaseCost(value, priority);
+            }
+            else
+            {
+                heap.insert(value, priority);
+            }
+        }
+    }
+
+    if (!heap.wasExtracted(destination))
+    {
+        return INT_MAX;
+    }
+
+    for (int node = destination; node != -1; node = workspace.getPrevious(node))
+    {
+        nodes.push_back(node);
+    }
+
+    std::reverse(nodes.begin(), nodes.end());
+
+    return workspace.getCost(destination);
+}
+
+int AltSearch::getSettledNodeCount() const
+{
+    return settledNodeCount;
+}
@@ -0,0 +1,52 @@
+#ifndef ALTSEARCH_H
+#define ALTSEARCH_H
+
+#include "Graph.h"
+#include "ShortestPathEngine.h"
+#include "LandmarkIndex.h"
+#include "IndexedDaryHeap.h"
+#include "ShortestPathWorkspace.h"
+#include <vector>
+
+/*!
+ * Represents a point-to-point shortest path engine using A* search with the landmarks' lower bounds as heuristic.
+ * The landmark bounds are consistent, so every extracted node is settled and the costs equal Dijkstra's.
+ */
+class AltSearch : public ShortestPathEngine
+{
+public:
+    /*!
+     * Constructor, creates an engine for the specified graph and landmarks.
+     * \param graph The graph to be searched, which must outlive the engine.
+     * \param landmarks The landmarks computed for the graph, which must outlive the engine.
+     */
+    AltSearch(const Graph& graph, const LandmarkIndex& landmarks);
+
+    /*!
+     * Calculates the shortest path between source and destination nodes,
+     * throws DijkstraInputException if the graph has changed since the landmarks were computed.
+     * \param source The source node.
+     * \param destination The destination node.
+     * \param nodes Filled with the nodes of the shortest path from source to destination, empty if there is no path.
+     * \return The cost of the shortest path, INT_MAX if there is no path.
+     */
+    int findShortestPath(int source, int destination, std::vector<int>& nodes) override;
+
+    /*!
+     * Gets the count of nodes settled by the last query.
+     * \return The settled node count.
+     */
+    int getSettledNodeCount() const;
+
+private:
+    const Graph& graph;
+    const LandmarkIndex& landmarks;
+    ShortestPathWorkspace workspace;
+    /*!
+     * The heap ordered by the cost from the source plus the lower bound to the destination
+     */
+    IndexedDaryHeap<long long, 4> heap;
+    int settledNodeCount;
+};
+
+#endif // ALTSEARCH_H
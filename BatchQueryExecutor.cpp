@@ -0,0 +1,204 @@
+#include "BatchQueryExecutor.h"
+#include "DijkstraInputException.h"
+#include <algorithm>
+
+BatchQueryExecutor::BatchQueryExecutor(const Graph& graph, int threadCount)
+    : graph(graph)
+{
+    this->batchNumber = 0;
+    this->busyWorkerCount = 0;
+    this->isStopping = false;
+    this->queries = nullptr;
+    this->costs = nullptr;
+    this->paths = nullptr;
+
+    if (threadCount <= 0)
+    {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        workers.push_back(std::unique_ptr<Worker>(new Worker()));
+    }
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back(&BatchQueryExecutor::work, this, i);
+    }
+}
+
+BatchQueryExecutor::~BatchQueryExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isStopping = true;
+    }
+
+    batchStarted.notify_all();
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void BatchQueryExecutor::run(const std::vector<std::pair<int, int>>& queries, std::vector<int>& costs, std::vector<std::vector<int>>* paths)
+{
+    // Validate in advance, so the threads do not have to report invalid queries
+    for (const std::pair<int, int>& query : queries)
+    {
+        if (!graph.doesNodeExist(query.first) || !graph.doesNodeExist(query.second))
+        {
+            throw DijkstraInputException("Query node does not exist in the graph.");
+        }
+    }
+
+    costs.assign(queries.size(), INT_MAX);
+    if (paths)
+    {
+        paths->assign(queries.size(), std::vector<int>());
+    }
+
+    if (queries.empty())
+    {
+        return;
+    }
+
+    // Build the snapshots now, as the threads may only read them
+    graph.prepareQueries();
+
+    // Deal the ranges out round robin, so every thread starts with an equal share
+    int threadCount = getThreadCount();
+    size_t rangeSize = std::max<size_t>(1, queries.size() / (static_cast<size_t>(threadCount) * RANGES_PER_THREAD));
+    int worker = 0;
+    for (size_t begin = 0; begin < queries.size(); begin += rangeSize)
+    {
+        workers[worker]->ranges.push_back(std::make_pair(begin, std::min(begin + rangeSize, queries.size())));
+        worker = (worker + 1) % threadCount;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    this->queries = &queries;
+    this->costs = &costs;
+    this->paths = paths;
+    this->error = nullptr;
+    busyWorkerCount = threadCount;
+    batchNumber++;
+    batchStarted.notify_all();
+
+    batchFinished.wait(lock, [this]() { return busyWorkerCount == 0; });
+
+    if (error)
+    {
+        // A failing thread stops with its ranges left, which must not be taken up by the next batch
+        for (std::unique_ptr<Worker>& idleWorker : workers)
+        {
+            std::lock_guard<std::mutex> workerLock(idleWorker->mutex);
+            idleWorker->ranges.clear();
+        }
+
+        std::rethrow_exception(error);
+    }
+}
+
+int BatchQueryExecutor::getThreadCount() const
+{
+    return static_cast<int>(threads.size());
+}
+
+void BatchQueryExecutor::work(int index)
+{
+    unsigned long long processedBatch = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            batchStarted.wait(lock, [this, processedBatch]() { return isStopping || batchNumber != processedBatch; });
+
+            if (isStopping)
+            {
+                return;
+            }
+
+            processedBatch = batchNumber;
+        }
+
+        try
+        {
+            processBatch(index);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--busyWorkerCount == 0)
+        {
+            batchFinished.notify_one();
+        }
+    }
+}
+
+void BatchQueryExecutor::processBatch(int index)
+{
+    Worker& own = *workers[index];
+    int threadCount = getThreadCount();
+    std::pair<size_t, size_t> range;
+
+    while (true)
+    {
+        // No ranges are added during a batch, so once all queues are empty the batch is done for this thread
+        bool hasRange = takeRange(own, true, range);
+        for (int i = 1; !hasRange && i < threadCount; i++)
+        {
+            hasRange = takeRange(*workers[(index + i) % threadCount], false, range);
+        }
+
+        if (!hasRange)
+        {
+            return;
+        }
+
+        for (size_t i = range.first; i < range.second; i++)
+        {
+            int source = (*queries)[i].first;
+            int destination = (*queries)[i].second;
+            int cost = graph.calculateShortestPathCost(source, destination, own.workspace);
+            (*costs)[i] = cost;
+
+            if (paths && cost != INT_MAX)
+            {
+                graph.getPathNodes(destination, own.workspace, (*paths)[i]);
+            }
+        }
+    }
+}
+
+bool BatchQueryExecutor::takeRange(Worker& worker, bool isOwner, std::pair<size_t, size_t>& range)
+{
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.ranges.empty())
+    {
+        return false;
+    }
+
+    if (isOwner)
+    {
+        range = worker.ranges.back();
+        worker.ranges.pop_back();
+    }
+    else
+    {
+        range = worker.ranges.front();
+        worker.ranges.pop_front();
+    }
+
+    return true;
+}
@@ -0,0 +1,110 @@
+#ifndef BATCHQUERYEXECUTOR_H
+#define BATCHQUERYEXECUTOR_H
+
+#include "Graph.h"
+#include "ShortestPathWorkspace.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*!
+ * Represents a pool of threads, which answer batches of point-to-point queries over a graph, that is not changed meanwhile.
+ * Every thread has its own workspace and a queue of query ranges. A thread, whose queue runs empty, steals ranges from the other queues,
+ * so the threads stay busy even if some queries take much longer than others.
+ */
+class BatchQueryExecutor
+{
+public:
+    /*!
+     * Constructor, starts the threads.
+     * \param graph The graph to be searched, which must outlive the executor and must not change while a batch runs.
+     * \param threadCount The count of threads, 0 for one per hardware thread.
+     */
+    BatchQueryExecutor(const Graph& graph, int threadCount = 0);
+    /*!
+     * Destructor, stops the threads.
+     */
+    ~BatchQueryExecutor();
+
+    BatchQueryExecutor(const BatchQueryExecutor&) = delete;
+    BatchQueryExecutor& operator=(const BatchQueryExecutor&) = delete;
+
+    /*!
+     * Calculates the shortest paths of a batch of queries and waits until all are done.
+     * \param queries The source and destination node of every query.
+     * \param costs Filled with the cost of every query, INT_MAX if there is no path.
+     * \param paths If not null, filled with the nodes of every query's shortest path, empty if there is no path.
+     */
+    void run(const std::vector<std::pair<int, int>>& queries, std::vector<int>& costs, std::vector<std::vector<int>>* paths = nullptr);
+
+    /*!
+     * Gets the count of threads.
+     * \return The thread count.
+     */
+    int getThreadCount() const;
+
+private:
+    /*!
+     * Represents the state of a thread.
+     */
+    struct Worker
+    {
+        ShortestPathWorkspace workspace;
+        /*!
+         * The ranges of query indices left to this thread, guarded by the mutex.
+         * The owner takes ranges from the back, other threads steal from the front.
+         */
+        std::deque<std::pair<size_t, size_t>> ranges;
+        std::mutex mutex;
+    };
+
+    /*!
+     * The count of ranges per thread a batch is split into, more ranges balance better but need more locking.
+     */
+    static const int RANGES_PER_THREAD = 16;
+
+    const Graph& graph;
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+
+    /*!
+     * The state of the current batch, guarded by the mutex.
+     */
+    std::mutex mutex;
+    std::condition_variable batchStarted;
+    std::condition_variable batchFinished;
+    unsigned long long batchNumber;
+    int busyWorkerCount;
+    bool isStopping;
+    std::exception_ptr error;
+
+    const std::vector<std::pair<int, int>>* queries;
+    std::vector<int>* costs;
+    std::vector<std::vector<int>>* paths;
+
+    /*!
+     * Runs a thread, which waits for batches and processes them.
+     * \param index The index of the thread's worker.
+     */
+    void work(int index);
+    /*!
+     * Processes ranges of the current batch until no thread has any left.
+     * \param index The index of the thread's worker.
+     */
+    void processBatch(int index);
+    /*!
+     * Takes a range from a worker's queue.
+     * \param worker The worker.
+     * \param isOwner Whether the calling thread owns the worker.
+     * \param range Set to the taken range.
+     * \return Whether there was a range.
+     */
+    static bool takeRange(Worker& worker, bool isOwner, std::pair<size_t, size_t>& range);
+};
+
+#endif // BATCHQUERYEXECUTOR_H
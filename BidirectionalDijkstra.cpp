@@ -0,0 +1,124 @@
+#include "BidirectionalDijkstra.h"
+#include "DijkstraException.h"
+#include <algorithm>
+
+BidirectionalDijkstra::BidirectionalDijkstra(const Graph& graph)
+    : graph(graph)
+{
+}
+
+int BidirectionalDijkstra::findShortestPath(int source, int destination, std::vector<int>& nodes)
+{
+    // The stopping criterion is only valid if costs never decrease along a path
+    if (graph.hasNegativeEdgeWeights())
+    {
+        throw DijkstraException("Bidirectional search requires non-negative edge weights.");
+    }
+
+    nodes.clear();
+
+    if (source == destination)
+    {
+        nodes.push_back(source);
+        return 0;
+    }
+
+    const CsrGraph& adjacency = graph.freeze();
+    const CsrGraph& reverseAdjacency = graph.freezeReverse();
+    int nodeCount = graph.getCurrentNodeCount();
+
+    forward.prepare(nodeCount);
+    backward.prepare(nodeCount);
+
+    IndexedDaryHeap<int, 4>& forwardHeap = forward.getHeap();
+    IndexedDaryHeap<int, 4>& backwardHeap = backward.getHeap();
+
+    forward.setCost(source, 0, -1);
+    forwardHeap.insert(source, 0);
+    backward.setCost(destination, 0, -1);
+    backwardHeap.insert(destination, 0);
+
+    long long bestCost = LLONG_MAX;
+    int meetingFrom = -1;
+    int meetingTo = -1;
+
+    // If one direction runs out of nodes, every path it could extend has already met the other direction
+    while (!forwardHeap.isEmpty() && !backwardHeap.isEmpty())
+    {
+        long long forwardMinimum = forwardHeap.getMinimumCost();
+        long long backwardMinimum = backwardHeap.getMinimumCost();
+
+        // No path through an unsettled node can be shorter than the best one found
+        if (forwardMinimum + backwardMinimum >= bestCost)
+        {
+            break;
+        }
+
+        if (forwardMinimum <= backwardMinimum)
+        {
+            settleNext(adjacency, forward, backward, true, bestCost, meetingFrom, meetingTo);
+        }
+        else
+        {
+            settleNext(reverseAdjacency, backward, forward, false, bestCost, meetingFrom, meetingTo);
+        }
+    }
+
+    if (meetingFrom == -1)
+    {
+        return INT_MAX;
+    }
+
+    // Follow the forward search's path back to the source, then the backward search's path on to the destination
+    for (int node = meetingFrom; node != -1; node = forward.getPrevious(node))
+    {
+        nodes.push_back(node);
+    }
+
+    std::reverse(nodes.begin(), nodes.end());
+
+    for (int node = meetingTo; node != -1; node = backward.getPrevious(node))
+    {
+        nodes.push_back(node);
+    }
+
+    return static_cast<int>(bestCost);
+}
+
+void BidirectionalDijkstra::settleNext(const CsrGraph& adjacency, ShortestPathWorkspace& current, ShortestPathWorkspace& other, bool isForward,
+                                       long long& bestCost, int& meetingFrom, int& meetingTo)
+{
+    IndexedDaryHeap<int, 4>& heap = current.getHeap();
+
+    int minimumNodeValue = heap.extractMinimum();
+    int minimumNodeCost = current.getCost(minimumNodeValue);
+
+    int edgeEnd = adjacency.getEdgeEnd(minimumNodeValue);
+    for (int edge = adjacency.getEdgeBegin(minimumNodeValue); edge < edgeEnd; ++edge)
+    {
+        int value = adjacency.getTarget(edge);
+        int newCost = adjacency.getWeight(edge) + minimumNodeCost;
+
+        if (!heap.wasExtracted(value) && newCost < current.getCost(value))
+        {
+            current.setCost(value, newCost, minimumNodeValue);
+            if (heap.doesNodeExist(value))
+            {
+                heap.decreaseCost(value, newCost);
+            }
+            else
+            {
+                heap.insert(value, newCost);
+            }
+        }
+
+        // The edge connects both searches if the other direction has reached its end
+        int otherCost = other.getCost(value);
+        if (otherCost != INT_MAX && static_cast<long long>(newCost) + otherCost < bestCost)
+        {
+            bestCost = static_cast<long long>(newCost) + otherCost;
+            meetingFrom = isForward ? minimumNodeValue : value;
+            meetingTo = isForward ? value : minimumNodeValue;
+        }
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef BIDIRECTIONALDIJKSTRA_H
+#define BIDIRECTIONALDIJKSTRA_H
+
+#include "Graph.h"
+#include "ShortestPathEngine.h"
+#include "ShortestPathWorkspace.h"
+#include <vector>
+
+/*!
+ * Represents a point-to-point shortest path engine, which searches forward from the source
+ * and backward from the destination at the same time, alternating by the smaller tentative cost.
+ * The search stops once the sum of both minimum tentative costs reaches the best path found through a meeting edge.
+ */
+class BidirectionalDijkstra : public ShortestPathEngine
+{
+public:
+    /*!
+     * Constructor, creates an engine for the specified graph.
+     * \param graph The graph to be searched, which must outlive the engine.
+     */
+    BidirectionalDijkstra(const Graph& graph);
+
+    /*!
+     * Calculates the shortest path between source and destination nodes.
+     * \param source The source node.
+     * \param destination The destination node.
+     * \param nodes Filled with the nodes of the shortest path from source to destination, empty if there is no path.
+     * \return The cost of the shortest path, INT_MAX if there is no path.
+     */
+    int findShortestPath(int source, int destination, std::vector<int>& nodes) override;
+
+private:
+    const Graph& graph;
+    ShortestPathWorkspace forward;
+    ShortestPathWorkspace backward;
+
+    /*!
+     * Settles the minimum node of one direction and relaxes its edges.
+     * \param adjacency The adjacency of the direction (the reverse adjacency for the backward search).
+     * \param current The workspace of the direction.
+     * \param other The workspace of the opposite direction.
+     * \param isForward Whether the direction is the forward one.
+     * \param bestCost The cost of the best path found so far, updated if a better one meets.
+     * \param meetingFrom The last node of the best path's forward part.
+     * \param meetingTo The first node of the best path's backward part.
+     */
+    void settleNext(const CsrGraph& adjacency, ShortestPathWorkspace& current, ShortestPathWorkspace& other, bool isForward,
+                    long long& bestCost, int& meetingFrom, int& meetingTo);
+};
+
+#endif // BIDIRECTIONALDIJKSTRA_H
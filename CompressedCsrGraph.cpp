@@ -0,0 +1,184 @@
+#include "CompressedCsrGraph.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+CompressedCsrGraph::CompressedCsrGraph(const CsrGraph& adjacency)
+{
+    this->nodeCount = adjacency.getNodeCount();
+    this->edgeCount = adjacency.getEdgeCount();
+    this->maximumDegree = 0;
+
+    int minimumWeight = 0;
+    int maximumWeight = 0;
+    for (int edge = 0; edge < edgeCount; edge++)
+    {
+        minimumWeight = std::min(minimumWeight, adjacency.getWeight(edge));
+        maximumWeight = std::max(maximumWeight, adjacency.getWeight(edge));
+    }
+
+    if (minimumWeight >= 0 && maximumWeight <= UCHAR_MAX)
+    {
+        this->weightWidth = 1;
+    }
+    else if (minimumWeight >= 0 && maximumWeight <= USHRT_MAX)
+    {
+        this->weightWidth = 2;
+    }
+    else
+    {
+        this->weightWidth = 4;
+    }
+
+    offsets.resize(nodeCount + 1);
+    std::vector<std::pair<int, int>> edges;
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        offsets[i] = static_cast<long long>(bytes.size());
+
+        edges.clear();
+        for (int edge = adjacency.getEdgeBegin(i); edge < adjacency.getEdgeEnd(i); edge++)
+        {
+            edges.push_back(std::make_pair(adjacency.getTarget(edge), adjacency.getWeight(edge)));
+        }
+
+        std::sort(edges.begin(), edges.end());
+        maximumDegree = std::max(maximumDegree, static_cast<int>(edges.size()));
+        writeVarint(static_cast<unsigned int>(edges.size()));
+
+        // The first target may lie below the node, so its distance is zigzag encoded, the later gaps are at least 1
+        int previousTarget = i;
+        for (size_t j = 0; j < edges.size(); j++)
+        {
+            int target = edges[j].first;
+            if (j == 0)
+            {
+                long long distance = static_cast<long long>(target) - i;
+                writeVarint(static_cast<unsigned int>(distance >= 0 ? 2 * distance : -2 * distance - 1));
+            }
+            else
+            {
+                writeVarint(static_cast<unsigned int>(target - previousTarget - 1));
+            }
+
+            previousTarget = target;
+        }
+
+        // The weights are stored in the byte order of the machine
+        for (const std::pair<int, int>& edge : edges)
+        {
+            if (weightWidth == 1)
+            {
+                bytes.push_back(static_cast<unsigned char>(edge.second));
+            }
+            else if (weightWidth == 2)
+            {
+                unsigned short weight = static_cast<unsigned short>(edge.second);
+                const unsigned char* weightBytes = reinterpret_cast<const unsigned char*>(&weight);
+                bytes.insert(bytes.end(), weightBytes, weightBytes + sizeof(weight));
+            }
+            else
+            {
+                const unsigned char* weightBytes = reinterpret_cast<const unsigned char*>(&edge.second);
+                bytes.insert(bytes.end(), weightBytes, weightBytes + sizeof(edge.second));
+            }
+        }
+    }
+
+    offsets[nodeCount] = static_cast<long long>(bytes.size());
+    bytes.shrink_to_fit();
+}
+
+int CompressedCsrGraph::getNodeCount() const
+{
+    return nodeCount;
+}
+
+int CompressedCsrGraph::getEdgeCount() const
+{
+    return edgeCount;
+}
+
+size_t CompressedCsrGraph::getByteCount() const
+{
+    return bytes.size() + offsets.size() * sizeof(long long);
+}
+
+int CompressedCsrGraph::getMaximumDegree() const
+{
+    return maximumDegree;
+}
+
+int CompressedCsrGraph::getDegree(int node) const
+{
+    const unsigned char* position = bytes.data() + offsets[node];
+    return static_cast<int>(readVarint(position));
+}
+
+int CompressedCsrGraph::decodeEdges(int node, int* targets, int* weights) const
+{
+    const unsigned char* position = bytes.data() + offsets[node];
+    int degree = static_cast<int>(readVarint(position));
+    if (degree == 0)
+    {
+        return 0;
+    }
+
+    unsigned int distance = readVarint(position);
+    int target = node + static_cast<int>((distance & 1) != 0 ? -static_cast<long long>(distance / 2) - 1 : static_cast<long long>(distance / 2));
+    targets[0] = target;
+    for (int i = 1; i < degree; i++)
+    {
+        target += static_cast<int>(readVarint(position)) + 1;
+        targets[i] = target;
+    }
+
+    if (weightWidth == 1)
+    {
+        for (int i = 0; i < degree; i++)
+        {
+            weights[i] = position[i];
+        }
+    }
+    else if (weightWidth == 2)
+    {
+        for (int i = 0; i < degree; i++)
+        {
+            unsigned short weight;
+            std::memcpy(&weight, position + 2 * i, sizeof(weight));
+            weights[i] = weight;
+        }
+    }
+    else
+    {
+        std::memcpy(weights, position, degree * sizeof(int));
+    }
+
+    return degree;
+}
+
+CsrGraph CompressedCsrGraph::decompress() const
+{
+    std::vector<int> csrOffsets(nodeCount + 1, 0);
+    std::vector<int> targets(edgeCount);
+    std::vector<int> weights(edgeCount);
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        csrOffsets[i + 1] = csrOffsets[i] + decodeEdges(i, targets.data() + csrOffsets[i], weights.data() + csrOffsets[i]);
+    }
+
+    return CsrGraph(nodeCount, std::move(csrOffsets), std::move(targets), std::move(weights));
+}
+
+void CompressedCsrGraph::writeVarint(unsigned int value)
+{
+    while (value >= 0x80)
+    {
+        bytes.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+
+    bytes.push_back(static_cast<unsigned char>(value));
+}
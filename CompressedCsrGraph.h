@@ -0,0 +1,113 @@
+#ifndef COMPRESSEDCSRGRAPH_H
+#define COMPRESSEDCSRGRAPH_H
+
+#include "CsrGraph.h"
+#include <cstddef>
+#include <vector>
+
+/*!
+ * Represents an immutable snapshot of a graph's adjacency, compressed to a few bytes per edge.
+ * The edges of every node are stored in one run of bytes: the edge count as a varint, the targets in ascending order as varints
+ * of their gaps, the first one relative to the node, followed by the weights in the narrowest width, which fits all weights of the graph.
+ * The runs are decoded on the fly by the queries, one node at a time.
+ */
+class CompressedCsrGraph
+{
+public:
+    /*!
+     * Constructor, compresses the specified adjacency.
+     * \param adjacency The adjacency, whose targets must be distinct for every node.
+     */
+    CompressedCsrGraph(const CsrGraph& adjacency);
+
+    /*!
+     * Gets the node count.
+     * \return The node count.
+     */
+    int getNodeCount() const;
+    /*!
+     * Gets the edge count.
+     * \return The edge count.
+     */
+    int getEdgeCount() const;
+    /*!
+     * Gets the memory used by the compressed adjacency.
+     * \return The size in bytes.
+     */
+    size_t getByteCount() const;
+    /*!
+     * Gets the largest count of edges leaving a node, which the buffers of decodeEdges have to hold.
+     * \return The maximum degree.
+     */
+    int getMaximumDegree() const;
+
+    /*!
+     * Gets the count of edges leaving a node.
+     * \param node The node.
+     * \return The node's edge count.
+     */
+    int getDegree(int node) const;
+    /*!
+     * Decodes the edges leaving a node, sorted by target.
+     * \param node The node.
+     * \param targets Filled with the destinations of the edges, needs room for getDegree(node) entries.
+     * \param weights Filled with the weights of the edges, needs room for getDegree(node) entries.
+     * \return The node's edge count.
+     */
+    int decodeEdges(int node, int* targets, int* weights) const;
+
+    /*!
+     * Decodes the whole adjacency.
+     * \return The uncompressed adjacency, with every node's edges sorted by target.
+     */
+    CsrGraph decompress() const;
+
+private:
+    int nodeCount;
+    int edgeCount;
+    int maximumDegree;
+    /*!
+     * The width of a weight in bytes, 1 or 2 for unsigned weights, 4 for the others.
+     */
+    int weightWidth;
+    /*!
+     * The position of every node's run in the bytes, followed by the size of the bytes.
+     */
+    std::vector<long long> offsets;
+    std::vector<unsigned char> bytes;
+
+    /*!
+     * Appends a varint, seven bits per byte, the highest bit flags further bytes.
+     * \param value The value.
+     */
+    void writeVarint(unsigned int value);
+    /*!
+     * Reads a varint.
+     * \param position The position of the varint, moved past it.
+     * \return The value.
+     */
+    static unsigned int readVarint(const unsigned char*& position);
+};
+
+inline unsigned int CompressedCsrGraph::readVarint(const unsigned char*& position)
+{
+    // Most gaps of a well ordered graph fit a single byte
+    unsigned int value = *position++;
+    if (value < 0x80)
+    {
+        return value;
+    }
+
+    value &= 0x7F;
+    for (int shift = 7; ; shift += 7)
+    {
+        unsigned int byte = *position++;
+        value |= (byte & 0x7F) << shift;
+        if (byte < 0x80)
+        {
+            return value;
+        }
+    }
+}
+
+#endif // COMPRESSEDCSRGRAPH_H
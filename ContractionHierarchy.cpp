@@ -0,0 +1,432 @@
+#include "ContractionHierarchy.h"
+#include "DijkstraException.h"
+#include "DijkstraInputException.h"
+#include "IndexedDaryHeap.h"
+#include <algorithm>
+
+class ContractionHierarchy::Contraction
+{
+public:
+    /*!
+     * The outgoing and incoming edges of every node, edges of contracted nodes are removed from their neighbours
+     */
+    std::vector<std::vector<Arc>> outArcs;
+    std::vector<std::vector<Arc>> inArcs;
+    std::vector<int> contractedNeighbours;
+    ShortestPathWorkspace witness;
+
+    Contraction(const Graph& graph)
+    {
+        int nodeCount = graph.getCurrentNodeCount();
+        const CsrGraph& adjacency = graph.freeze();
+
+        outArcs.resize(nodeCount);
+        inArcs.resize(nodeCount);
+        contractedNeighbours.assign(nodeCount, 0);
+
+        for (int i = 0; i < nodeCount; i++)
+        {
+            int edgeEnd = adjacency.getEdgeEnd(i);
+            for (int edge = adjacency.getEdgeBegin(i); edge < edgeEnd; edge++)
+            {
+                int target = adjacency.getTarget(edge);
+                outArcs[i].push_back({ target, adjacency.getWeight(edge), -1 });
+                inArcs[target].push_back({ i, adjacency.getWeight(edge), -1 });
+            }
+        }
+    }
+
+    /*!
+     * Contracts a node or only counts the shortcuts its contraction would add.
+     * \param node The node.
+     * \param simulate Whether the contraction is only simulated.
+     * \return The count of needed shortcuts.
+     */
+    int contract(int node, bool simulate)
+    {
+        int shortcuts = 0;
+
+        for (const Arc& in : inArcs[node])
+        {
+            // The witness search only has to look as far as the longest path through the node
+            long long maximumCost = -1;
+            for (const Arc& out : outArcs[node])
+            {
+                if (out.node != in.node && static_cast<long long>(in.weight) + out.weight > maximumCost)
+                {
+                    maximumCost = static_cast<long long>(in.weight) + out.weight;
+                }
+            }
+
+            if (maximumCost < 0)
+            {
+                continue;
+            }
+
+            searchWitnesses(in.node, node, maximumCost, simulate ? SIMULATION_SETTLE_LIMIT : WITNESS_SETTLE_LIMIT);
+
+            for (const Arc& out : outArcs[node])
+            {
+                long long cost = static_cast<long long>(in.weight) + out.weight;
+                if (out.node == in.node || witness.getCost(out.node) <= cost)
+                {
+                    continue;
+                }
+
+                shortcuts++;
+                if (!simulate)
+                {
+                    addShortcut(in.node, out.node, static_cast<int>(cost), node);
+                }
+            }
+        }
+
+        return shortcuts;
+    }
+
+    /*!
+     * Removes a contracted node from its neighbours' edges.
+     * \param node The node.
+     */
+    void removeNode(int node)
+    {
+        for (const Arc& out : outArcs[node])
+        {
+            removeArc(inArcs[out.node], node);
+            contractedNeighbours[out.node]++;
+        }
+
+        for (const Arc& in : inArcs[node])
+        {
+            removeArc(outArcs[in.node], node);
+            contractedNeighbours[in.node]++;
+        }
+    }
+
+    /*!
+     * Calculates the priority of a node, nodes with lower priority are contracted first.
+     * \param node The node.
+     * \return The edge difference plus the count of contracted neighbours.
+     */
+    int getPriority(int node)
+    {
+        int removedEdges = static_cast<int>(inArcs[node].size() + outArcs[node].size());
+        return contract(node, true) - removedEdges + contractedNeighbours[node];
+    }
+
+private:
+    /*!
+     * Calculates the costs from a node, avoiding the node being contracted, up to the specified cost.
+     */
+    void searchWitnesses(int source, int avoidedNode, long long maximumCost, int settleLimit)
+    {
+        witness.prepare(static_cast<int>(outArcs.size()));
+        IndexedDaryHeap<int, 4>& heap = witness.getHeap();
+
+        witness.setCost(source, 0, -1);
+        heap.insert(source, 0);
+
+        int settledCount = 0;
+        while (!heap.isEmpty() && heap.getMinimumCost() <= maximumCost && settledCount < settleLimit)
+        {
+            int minimumNodeValue = heap.extractMinimum();
+            int minimumNodeCost = witness.getCost(minimumNodeValue);
+            settledCount++;
+
+            for (const Arc& arc : outArcs[minimumNodeValue])
+            {
+                long long newCost = static_cast<long long>(minimumNodeCost) + arc.weight;
+                if (arc.node == avoidedNode || heap.wasExtracted(arc.node) || newCost >= witness.getCost(arc.node))
+                {
+                    continue;
+                }
+
+                witness.setCost(arc.node, static_cast<int>(newCost), minimumNodeValue);
+                if (heap.doesNodeExist(arc.node))
+                {
+                    heap.decreaseCost(arc.node, static_cast<int>(newCost));
+                }
+                else
+                {
+                    heap.insert(arc.node, static_cast<int>(newCost));
+                }
+            }
+        }
+    }
+
+    /*!
+     * Adds a shortcut or shortens an existing edge between two nodes.
+     */
+    void addShortcut(int from, int to, int weight, int middle)
+    {
+        for (Arc& out : outArcs[from])
+        {
+            if (out.node == to)
+            {
+                if (weight < out.weight)
+                {
+                    out.weight = weight;
+                    out.middle = middle;
+
+                    for (Arc& in : inArcs[to])
+                    {
+                        if (in.node == from)
+                        {
+                            in.weight = weight;
+                            in.middle = middle;
+                        }
+                    }
+                }
+
+                return;
+            }
+        }
+
+        outArcs[from].push_back({ to, weight, middle });
+        inArcs[to].push_back({ from, weight, middle });
+    }
+
+    static void removeArc(std::vector<Arc>& arcs, int node)
+    {
+        for (size_t i = 0; i < arcs.size(); i++)
+        {
+            if (arcs[i].node == node)
+            {
+                arcs[i] = arcs.back();
+                arcs.pop_back();
+                return;
+            }
+        }
+    }
+};
+
+ContractionHierarchy::ContractionHierarchy(const Graph& graph)
+    : graph(graph)
+{
+    // Witness searches and the query's stopping criterion rely on non-negative weights
+    if (graph.hasNegativeEdgeWeights())
+    {
+        throw DijkstraException("Contraction hierarchies require non-negative edge weights.");
+    }
+
+    this->nodeCount = graph.getCurrentNodeCount();
+    this->shortcutCount = 0;
+    this->graphVersion = graph.getVersion();
+
+    Contraction contraction(graph);
+    std::vector<std::vector<Arc>> upward(nodeCount);
+    std::vector<std::vector<Arc>> downward(nodeCount);
+    ranks.assign(nodeCount, -1);
+
+    // Order the nodes by their initial priority
+    IndexedDaryHeap<int, 4> queue(nodeCount);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        queue.insert(i, contraction.getPriority(i));
+    }
+
+    int rank = 0;
+    while (!queue.isEmpty())
+    {
+        int node = queue.extractMinimum();
+
+        // The priority may have grown since it was computed, so it is updated lazily and the node waits if it is not minimal anymore
+        int priority = contraction.getPriority(node);
+        if (!queue.isEmpty() && priority > queue.getMinimumCost())
+        {
+            queue.insert(node, priority);
+            continue;
+        }
+
+        shortcutCount += contraction.contract(node, false);
+
+        // The remaining edges of the node lead to and from nodes contracted later
+        upward[node] = contraction.outArcs[node];
+        downward[node] = contraction.inArcs[node];
+        contraction.removeNode(node);
+
+        ranks[node] = rank++;
+    }
+
+    // Pack the edges of the hierarchy
+    upwardOffsets.assign(nodeCount + 1, 0);
+    downwardOffsets.assign(nodeCount + 1, 0);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        upwardOffsets[i + 1] = upwardOffsets[i] + static_cast<int>(upward[i].size());
+        downwardOffsets[i + 1] = downwardOffsets[i] + static_cast<int>(downward[i].size());
+        upwardArcs.insert(upwardArcs.end(), upward[i].begin(), upward[i].end());
+        downwardArcs.insert(downwardArcs.end(), downward[i].begin(), downward[i].end());
+    }
+}
+
+int ContractionHierarchy::findShortestPath(int source, int destination, std::vector<int>& nodes)
+{
+    if (source < 0 || source >= nodeCount)
+    {
+        throw DijkstraInputException("Source does not exist in the graph.");
+    }
+
+    if (destination < 0 || destination >= nodeCount)
+    {
+        throw DijkstraInputException("Destination does not exist in the graph.");
+    }
+
+    // The shortcuts do not know about edges added or reweighted after the contraction
+    if (graph.getVersion() != graphVersion)
+    {
+        throw DijkstraInputException("Graph has changed since the contraction hierarchy was built.");
+    }
+
+    nodes.clear();
+
+    forward.prepare(nodeCount);
+    backward.prepare(nodeCount);
+
+    IndexedDaryHeap<int, 4>& forwardHeap = forward.getHeap();
+    IndexedDaryHeap<int, 4>& backwardHeap = backward.getHeap();
+
+    forward.setCost(source, 0, -1);
+    forwardHeap.insert(source, 0);
+    backward.setCost(destination, 0, -1);
+    backwardHeap.insert(destination, 0);
+
+    long long bestCost = LLONG_MAX;
+    int meetingNode = -1;
+
+    while (!forwardHeap.isEmpty() || !backwardHeap.isEmpty())
+    {
+        long long forwardMinimum = forwardHeap.isEmpty() ? LLONG_MAX : forwardHeap.getMinimumCost();
+        long long backwardMinimum = backwardHeap.isEmpty() ? LLONG_MAX : backwardHeap.getMinimumCost();
+
+        // Each direction continues until its own minimum reaches the best path, as the upward searches do not meet in the middle
+        if (std::min(forwardMinimum, backwardMinimum) >= bestCost)
+        {
+            break;
+        }
+
+        bool isForward = forwardMinimum <= backwardMinimum;
+        ShortestPathWorkspace& current = isForward ? forward : backward;
+        ShortestPathWorkspace& other = isForward ? backward : forward;
+        const std::vector<int>& offsets = isForward ? upwardOffsets : downwardOffsets;
+        const std::vector<Arc>& arcs = isForward ? upwardArcs : downwardArcs;
+        IndexedDaryHeap<int, 4>& heap = current.getHeap();
+
+        int minimumNodeValue = heap.extractMinimum();
+        int minimumNodeCost = current.getCost(minimumNodeValue);
+
+        int otherCost = other.getCost(minimumNodeValue);
+        if (otherCost != INT_MAX && static_cast<long long>(minimumNodeCost) + otherCost < bestCost)
+        {
+            bestCost = static_cast<long long>(minimumNodeCost) + otherCost;
+            meetingNode = minimumNodeValue;
+        }
+
+        for (int i = offsets[minimumNodeValue]; i < offsets[minimumNodeValue + 1]; i++)
+        {
+            int value = arcs[i].node;
+            int newCost = arcs[i].weight + minimumNodeCost;
+
+            if (!heap.wasExtracted(value) && newCost < current.getCost(value))
+            {
+                current.setCost(value, newCost, minimumNodeValue);
+                if (heap.doesNodeExist(value))
+                {
+                    heap.decreaseCost(value, newCost);
+                }
+                else
+                {
+                    heap.insert(value, newCost);
+                }
+            }
+        }
+    }
+
+    if (meetingNode == -1)
+    {
+        return INT_MAX;
+    }
+
+    // Collect the hierarchy's path from the source up to the meeting node and down to the destination
+    std::vector<int> hierarchyPath;
+    for (int node = meetingNode; node != -1; node = forward.getPrevious(node))
+    {
+        hierarchyPath.push_back(node);
+    }
+
+    std::reverse(hierarchyPath.begin(), hierarchyPath.end());
+
+    for (int node = backward.getPrevious(meetingNode); node != -1; node = backward.getPrevious(node))
+    {
+        hierarchyPath.push_back(node);
+    }
+
+    nodes.push_back(source);
+    for (size_t i = 1; i < hierarchyPath.size(); i++)
+    {
+        unpackArc(hierarchyPath[i - 1], hierarchyPath[i], nodes);
+    }
+
+    return static_cast<int>(bestCost);
+}
+
+int ContractionHierarchy::getRank(int node) const
+{
+    return ranks[node];
+}
+
+int ContractionHierarchy::getShortcutCount() const
+{
+    return shortcutCount;
+}
+
+const ContractionHierarchy::Arc& ContractionHierarchy::findArc(int from, int to) const
+{
+    if (ranks[from] < ranks[to])
+    {
+        for (int i = upwardOffsets[from]; i < upwardOffsets[from + 1]; i++)
+        {
+            if (upwardArcs[i].node == to)
+            {
+                return upwardArcs[i];
+            }
+        }
+    }
+    else
+    {
+        for (int i = downwardOffsets[to]; i < downwardOffsets[to + 1]; i++)
+        {
+            if (downwardArcs[i].node == from)
+            {
+                return downwardArcs[i];
+            }
+        }
+    }
+
+    throw DijkstraException("Contraction hierarchy is missing an edge of a path.");
+}
+
+void ContractionHierarchy::unpackArc(int from, int to, std::vector<int>& nodes) const
+{
+    // Unpack with an explicit stack, as shortcuts can be nested deeply
+    std::vector<std::pair<int, int>> stack;
+    stack.push_back(std::make_pair(from, to));
+
+    while (!stack.empty())
+    {
+        std::pair<int, int> arc = stack.back();
+        stack.pop_back();
+
+        int middle = findArc(arc.first, arc.second).middle;
+        if (middle == -1)
+        {
+            nodes.push_back(arc.second);
+        }
+        else
+        {
+            // The first half is unpacked first, so it is pushed last
+            stack.push_back(std::make_pair(middle, arc.second));
+            stack.push_back(std::make_pair(arc.first, middle));
+        }
+    }
+}
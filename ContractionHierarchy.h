@@ -0,0 +1,114 @@
+#ifndef CONTRACTIONHIERARCHY_H
+#define CONTRACTIONHIERARCHY_H
+
+#include "Graph.h"
+#include "ShortestPathEngine.h"
+#include "ShortestPathWorkspace.h"
+#include <vector>
+
+/*!
+ * Represents a contraction hierarchy of a graph and the query engine using it.
+ * The nodes are contracted one by one in the order of their edge difference. Contracting a node adds a shortcut
+ * between each pair of its neighbours, unless a witness search finds a path at most as short without the node.
+ * A query is a bidirectional search, which only follows edges towards nodes contracted later.
+ */
+class ContractionHierarchy : public ShortestPathEngine
+{
+public:
+    /*!
+     * Constructor, contracts all nodes of the specified graph.
+     * \param graph The graph, which must have non-negative edge weights and outlive the hierarchy.
+     */
+    ContractionHierarchy(const Graph& graph);
+
+    /*!
+     * Calculates the shortest path between source and destination nodes, with all shortcuts unpacked into original edges.
+     * Throws DijkstraInputException if a node does not exist or the graph has changed since the hierarchy was built.
+     * \param source The source node.
+     * \param destination The destination node.
+     * \param nodes Filled with the nodes of the shortest path from source to destination, empty if there is no path.
+     * \return The cost of the shortest path, INT_MAX if there is no path.
+     */
+    int findShortestPath(int source, int destination, std::vector<int>& nodes) override;
+
+    /*!
+     * Gets the position of a node in the contraction order.
+     * \param node The node.
+     * \return The node's rank, nodes contracted later have higher ranks.
+     */
+    int getRank(int node) const;
+    /*!
+     * Gets the count of shortcuts added by the contraction.
+     * \return The shortcut count.
+     */
+    int getShortcutCount() const;
+
+private:
+    /*!
+     * Represents an edge of the graph during the contraction.
+     */
+    struct Arc
+    {
+        int node;
+        int weight;
+        /*!
+         * The contracted node, which a shortcut bypasses, -1 for original edges.
+         */
+        int middle;
+    };
+
+    /*!
+     * The count of nodes, after which a witness search gives up and a shortcut is added.
+     */
+    static const int WITNESS_SETTLE_LIMIT = 500;
+    /*!
+     * The witness search limit used when a contraction is only simulated to compute a node's priority.
+     */
+    static const int SIMULATION_SETTLE_LIMIT = 50;
+
+    int nodeCount;
+    int shortcutCount;
+    /*!
+     * The graph and its version, when the hierarchy was built.
+     */
+    const Graph& graph;
+    unsigned long long graphVersion;
+    std::vector<int> ranks;
+
+    /*!
+     * The edges from every node to nodes of higher rank, in compressed sparse row form.
+     */
+    std::vector<int> upwardOffsets;
+    std::vector<Arc> upwardArcs;
+    /*!
+     * The edges to every node from nodes of higher rank, in compressed sparse row form.
+     * The node of an arc is the source of the edge.
+     */
+    std::vector<int> downwardOffsets;
+    std::vector<Arc> downwardArcs;
+
+    ShortestPathWorkspace forward;
+    ShortestPathWorkspace backward;
+
+    /*!
+     * Returns the edge between two nodes from the hierarchy.
+     * \param from The edge's source.
+     * \param to The edge's destination.
+     * \return The edge, the lower ranked node keeps it.
+     */
+    const Arc& findArc(int from, int to) const;
+    /*!
+     * Appends the original nodes of an edge to a path, replacing shortcuts by the edges they bypass.
+     * \param from The edge's source, which has already been appended.
+     * \param to The edge's destination.
+     * \param nodes The path.
+     */
+    void unpackArc(int from, int to, std::vector<int>& nodes) const;
+
+    /*!
+     * Represents the state of the contraction.
+     */
+    class Contraction;
+};
+
+#endif // CONTRACTIONHIERARCHY_H
@@ -0,0 +1,167 @@
+#include "CsrGraph.h"
+#include <utility>
+
+CsrGraph::CsrGraph()
+{
+    this->nodeCount = 0;
+    this->isView = false;
+    this->offsets.assign(1, 0);
+    attachOwnedArrays();
+}
+
+CsrGraph::CsrGraph(int nodeCount, Node** head)
+{
+    this->nodeCount = nodeCount;
+    this->isView = false;
+
+    // Count the edges leading from every node, so the offsets can be computed before packing.
+    offsets.assign(nodeCount + 1, 0);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        int degree = 0;
+        for (Node* adjacent = head[i]; adjacent != nullptr; adjacent = adjacent->getNextNode())
+        {
+            degree++;
+        }
+
+        offsets[i + 1] = offsets[i] + degree;
+    }
+
+    targets.resize(offsets[nodeCount]);
+    weights.resize(offsets[nodeCount]);
+
+    // Copy every adjacency list into its own contiguous run.
+    for (int i = 0; i < nodeCount; i++)
+    {
+        int edge = offsets[i];
+        for (Node* adjacent = head[i]; adjacent != nullptr; adjacent = adjacent->getNextNode())
+        {
+            targets[edge] = adjacent->getValue();
+            weights[edge] = adjacent->getCost();
+            edge++;
+        }
+    }
+
+    attachOwnedArrays();
+}
+
+CsrGraph::CsrGraph(int nodeCount, const int* offsets, const int* targets, const int* weights)
+{
+    this->nodeCount = nodeCount;
+    this->isView = true;
+    this->offsetData = offsets;
+    this->targetData = targets;
+    this->weightData = weights;
+}
+
+CsrGraph::CsrGraph(int nodeCount, std::vector<int>&& offsets, std::vector<int>&& targets, std::vector<int>&& weights)
+{
+    this->nodeCount = nodeCount;
+    this->isView = false;
+    this->offsets = std::move(offsets);
+    this->targets = std::move(targets);
+    this->weights = std::move(weights);
+    attachOwnedArrays();
+}
+
+CsrGraph::CsrGraph(const CsrGraph& other)
+{
+    *this = other;
+}
+
+CsrGraph& CsrGraph::operator=(const CsrGraph& other)
+{
+    nodeCount = other.nodeCount;
+    isView = other.isView;
+    offsets = other.offsets;
+    targets = other.targets;
+    weights = other.weights;
+    offsetData = other.offsetData;
+    targetData = other.targetData;
+    weightData = other.weightData;
+
+    if (!isView)
+    {
+        attachOwnedArrays();
+    }
+
+    return *this;
+}
+
+CsrGraph::CsrGraph(CsrGraph&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+CsrGraph& CsrGraph::operator=(CsrGraph&& other) noexcept
+{
+    // Moving a vector keeps its buffer, so the pointers of an owning snapshot stay valid as well
+    nodeCount = other.nodeCount;
+    isView = other.isView;
+    offsets = std::move(other.offsets);
+    targets = std::move(other.targets);
+    weights = std::move(other.weights);
+    offsetData = other.offsetData;
+    targetData = other.targetData;
+    weightData = other.weightData;
+
+    other.nodeCount = 0;
+    other.isView = false;
+    other.offsets.assign(1, 0);
+    other.targets.clear();
+    other.weights.clear();
+    other.attachOwnedArrays();
+
+    return *this;
+}
+
+CsrGraph CsrGraph::transpose() const
+{
+    CsrGraph reversed;
+    reversed.nodeCount = nodeCount;
+
+    // Count the incoming edges of every node, then place each edge at its destination's next free index
+    reversed.offsets.assign(nodeCount + 1, 0);
+    for (int edge = 0; edge < getEdgeCount(); edge++)
+    {
+        reversed.offsets[targetData[edge] + 1]++;
+    }
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        reversed.offsets[i + 1] += reversed.offsets[i];
+    }
+
+    reversed.targets.resize(getEdgeCount());
+    reversed.weights.resize(getEdgeCount());
+    std::vector<int> positions(reversed.offsets.begin(), reversed.offsets.end() - 1);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        for (int edge = offsetData[i]; edge < offsetData[i + 1]; edge++)
+        {
+            int position = positions[targetData[edge]]++;
+            reversed.targets[position] = i;
+            reversed.weights[position] = weightData[edge];
+        }
+    }
+
+    reversed.attachOwnedArrays();
+    return reversed;
+}
+
+int CsrGraph::getNodeCount() const
+{
+    return nodeCount;
+}
+
+int CsrGraph::getEdgeCount() const
+{
+    return offsetData[nodeCount];
+}
+
+void CsrGraph::attachOwnedArrays()
+{
+    offsetData = offsets.data();
+    targetData = targets.data();
+    weightData = weights.data();
+}
@@ -0,0 +1,181 @@
+#ifndef CSRGRAPH_H
+#define CSRGRAPH_H
+
+#include "Node.h"
+#include <vector>
+
+/*!
+ * Represents an immutable snapshot of a graph's adjacency in compressed sparse row form.
+ * The outgoing edges of node i are stored contiguously at indices [getEdgeBegin(i), getEdgeEnd(i)).
+ * A snapshot either owns its arrays or views arrays owned by someone else, such as a mapped graph file.
+ */
+class CsrGraph
+{
+public:
+    /*!
+     * Default constructor, creates an empty snapshot.
+     */
+    CsrGraph();
+    /*!
+     * Constructor, packs the specified adjacency lists into contiguous arrays.
+     * The edges of every node keep the order of its adjacency list.
+     * \param nodeCount The count of all the nodes.
+     * \param head The head nodes of the adjacency lists.
+     */
+    CsrGraph(int nodeCount, Node** head);
+    /*!
+     * Constructor, creates a view of arrays in compressed sparse row form without copying them.
+     * \param nodeCount The count of all the nodes.
+     * \param offsets The index of every node's first edge, followed by the edge count, which must outlive the view.
+     * \param targets The destinations of all edges, which must outlive the view.
+     * \param weights The weights of all edges, which must outlive the view.
+     */
+    CsrGraph(int nodeCount, const int* offsets, const int* targets, const int* weights);
+    /*!
+     * Constructor, takes over arrays in compressed sparse row form.
+     * \param nodeCount The count of all the nodes.
+     * \param offsets The index of every node's first edge, followed by the edge count.
+     * \param targets The destinations of all edges.
+     * \param weights The weights of all edges.
+     */
+    CsrGraph(int nodeCount, std::vector<int>&& offsets, std::vector<int>&& targets, std::vector<int>&& weights);
+    /*!
+     * Copy constructor, a copy of a view is a view of the same arrays.
+     * \param other The copied snapshot.
+     */
+    CsrGraph(const CsrGraph& other);
+    /*!
+     * Assignment operator, an assigned view is a view of the same arrays.
+     * \param other The assigned snapshot.
+     * \return This snapshot.
+     */
+    CsrGraph& operator=(const CsrGraph& other);
+    /*!
+     * Move constructor, takes over the arrays of the other snapshot.
+     * \param other The moved snapshot.
+     */
+    CsrGraph(CsrGraph&& other) noexcept;
+    /*!
+     * Move assignment operator, takes over the arrays of the other snapshot.
+     * \param other The moved snapshot.
+     * \return This snapshot.
+     */
+    CsrGraph& operator=(CsrGraph&& other) noexcept;
+
+    /*!
+     * Creates a snapshot with every edge reversed, which owns its arrays.
+     * \return The reversed snapshot.
+     */
+    CsrGraph transpose() const;
+
+    /*!
+     * Gets the node count.
+     * \return The node count.
+     */
+    int getNodeCount() const;
+    /*!
+     * Gets the edge count.
+     * \return The edge count.
+     */
+    int getEdgeCount() const;
+
+    /*!
+     * Gets the index of the first outgoing edge of a node.
+     * \param node The node.
+     * \return The index of the node's first edge.
+     */
+    int getEdgeBegin(int node) const;
+    /*!
+     * Gets the index past the last outgoing edge of a node.
+     * \param node The node.
+     * \return The index past the node's last edge.
+     */
+    int getEdgeEnd(int node) const;
+    /*!
+     * Gets the destination of an edge.
+     * \param edge The edge's index.
+     * \return The edge's destination.
+     */
+    int getTarget(int edge) const;
+    /*!
+     * Gets the weight of an edge.
+     * \param edge The edge's index.
+     * \return The edge's weight.
+     */
+    int getWeight(int edge) const;
+    /*!
+     * Gets the destinations of all edges, the ones of a node's edges are contiguous.
+     * \return The destinations, indexed by edge.
+     */
+    const int* getTargets() const;
+    /*!
+     * Gets the index of every node's first edge, followed by the edge count.
+     * \return The offsets, indexed by node.
+     */
+    const int* getOffsets() const;
+    /*!
+     * Gets the weights of all edges, the ones of a node's edges are contiguous.
+     * \return The weights, indexed by edge.
+     */
+    const int* getWeights() const;
+
+private:
+    int nodeCount;
+    bool isView;
+    /*!
+     * The owned arrays, empty for a view.
+     */
+    std::vector<int> offsets;
+    std::vector<int> targets;
+    std::vector<int> weights;
+    /*!
+     * The arrays read by the accessors, either the owned ones or the viewed ones.
+     */
+    const int* offsetData;
+    const int* targetData;
+    const int* weightData;
+
+    /*!
+     * Points the accessors to the owned arrays.
+     */
+    void attachOwnedArrays();
+};
+
+// The accessors are used in the inner loops of the queries, so they are defined here to be inlined.
+
+inline int CsrGraph::getEdgeBegin(int node) const
+{
+    return offsetData[node];
+}
+
+inline int CsrGraph::getEdgeEnd(int node) const
+{
+    return offsetData[node + 1];
+}
+
+inline int CsrGraph::getTarget(int edge) const
+{
+    return targetData[edge];
+}
+
+inline int CsrGraph::getWeight(int edge) const
+{
+    return weightData[edge];
+}
+
+inline const int* CsrGraph::getTargets() const
+{
+    return targetData;
+}
+
+inline const int* CsrGraph::getOffsets() const
+{
+    return offsetData;
+}
+
+inline const int* CsrGraph::getWeights() const
+{
+    return weightData;
+}
+
+#endif // CSRGRAPH_H
@@ -0,0 +1,607 @@
+#include "CustomizableContractionHierarchy.h"
+#include "DijkstraException.h"
+#include "DijkstraInputException.h"
+#include "IndexedDaryHeap.h"
+#include <algorithm>
+#include <thread>
+
+CustomizableContractionHierarchy::CustomizableContractionHierarchy(const Graph& graph)
+    : graph(graph)
+{
+    this->nodeCount = graph.getCurrentNodeCount();
+    this->graphVersion = graph.getVersion();
+
+    // The order only depends on which nodes are adjacent, regardless of the edges' directions
+    const CsrGraph& adjacency = graph.freeze();
+    std::vector<std::vector<int>> neighbours(nodeCount);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        int edgeEnd = adjacency.getEdgeEnd(i);
+        for (int edge = adjacency.getEdgeBegin(i); edge < edgeEnd; edge++)
+        {
+            int target = adjacency.getTarget(edge);
+            if (target != i)
+            {
+                neighbours[i].push_back(target);
+                neighbours[target].push_back(i);
+            }
+        }
+    }
+
+    for (std::vector<int>& list : neighbours)
+    {
+        std::sort(list.begin(), list.end());
+        list.erase(std::unique(list.begin(), list.end()), list.end());
+    }
+
+    computeOrder(neighbours);
+    buildArcs(neighbours);
+
+    customize(graph);
+}
+
+void CustomizableContractionHierarchy::customize(const Graph& graph)
+{
+    // Customization and the query's stopping criterion rely on non-negative weights
+    if (graph.hasNegativeEdgeWeights())
+    {
+        throw DijkstraException("Contraction hierarchies require non-negative edge weights.");
+    }
+
+    const CsrGraph& adjacency = graph.freeze();
+    if (&graph != &this->graph || graph.getCurrentNodeCount() != nodeCount)
+    {
+        throw DijkstraInputException("Graph topology differs from the customizable contraction hierarchy.");
+    }
+
+    // Restoring a compressed or mapped adjacency can change the order of the snapshot's edges, so they are mapped again
+    if (!areEdgesMapped(adjacency))
+    {
+        mapEdges(adjacency);
+    }
+
+    graphVersion = graph.getVersion();
+
+    int arcCount = getArcCount();
+    upWeights.assign(arcCount, INT_MAX);
+    downWeights.assign(arcCount, INT_MAX);
+    upMiddles.assign(arcCount, -1);
+    downMiddles.assign(arcCount, -1);
+
+    // Arcs without an original edge in a direction stay unreachable until a lower triangle provides a path
+    for (int edge = 0; edge < adjacency.getEdgeCount(); edge++)
+    {
+        int arc = edgeArcs[edge];
+        if (arc == -1)
+        {
+            continue;
+        }
+
+        std::vector<int>& weights = isEdgeUpward[edge] ? upWeights : downWeights;
+        weights[arc] = std::min(weights[arc], adjacency.getWeight(edge));
+    }
+
+    // A node only writes its own upward arcs and reads arcs of lower levels, so the nodes of a level are independent
+    unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t level = 0; level + 1 < levelOffsets.size(); level++)
+    {
+        int levelBegin = levelOffsets[level];
+        int levelEnd = levelOffsets[level + 1];
+
+        if (threadCount == 1 || levelEnd - levelBegin < PARALLEL_LEVEL_SIZE)
+        {
+            for (int i = levelBegin; i < levelEnd; i++)
+            {
+                customizeNode(levelNodes[i]);
+            }
+
+            continue;
+        }
+
+        std::vector<std::thread> threads;
+        int chunkSize = (levelEnd - levelBegin + static_cast<int>(threadCount) - 1) / static_cast<int>(threadCount);
+        for (int chunkBegin = levelBegin; chunkBegin < levelEnd; chunkBegin += chunkSize)
+        {
+            int chunkEnd = std::min(chunkBegin + chunkSize, levelEnd);
+            threads.emplace_back([this, chunkBegin, chunkEnd]()
+            {
+                for (int i = chunkBegin; i < chunkEnd; i++)
+                {
+                    customizeNode(levelNodes[i]);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+}
+
+int CustomizableContractionHierarchy::findShortestPath(int source, int destination, std::vector<int>& nodes)
+{
+    if (source < 0 || source >= nodeCount)
+    {
+        throw DijkstraInputException("Source does not exist in the graph.");
+    }
+
+    if (destination < 0 || destination >= nodeCount)
+    {
+        throw DijkstraInputException("Destination does not exist in the graph.");
+    }
+
+    // The arcs' weights are those of the last customization, a changed graph has to be customized again first
+    if (graph.getVersion() != graphVersion)
+    {
+        throw DijkstraInputException("Graph has changed since the customizable contraction hierarchy was customized.");
+    }
+
+    nodes.clear();
+
+    forward.prepare(nodeCount);
+    backward.prepare(nodeCount);
+
+    IndexedDaryHeap<int, 4>& forwardHeap = forward.getHeap();
+    IndexedDaryHeap<int, 4>& backwardHeap = backward.getHeap();
+
+    // Both searches run on ranks
+    forward.setCost(ranks[source], 0, -1);
+    forwardHeap.insert(ranks[source], 0);
+    backward.setCost(ranks[destination], 0, -1);
+    backwardHeap.insert(ranks[destination], 0);
+
+    long long bestCost = LLONG_MAX;
+    int meetingNode = -1;
+
+    while (!forwardHeap.isEmpty() || !backwardHeap.isEmpty())
+    {
+        long long forwardMinimum = forwardHeap.isEmpty() ? LLONG_MAX : forwardHeap.getMinimumCost();
+        long long backwardMinimum = backwardHeap.isEmpty() ? LLONG_MAX : backwardHeap.getMinimumCost();
+
+        if (std::min(forwardMinimum, backwardMinimum) >= bestCost)
+        {
+            break;
+        }
+
+        bool isForward = forwardMinimum <= backwardMinimum;
+        ShortestPathWorkspace& current = isForward ? forward : backward;
+        ShortestPathWorkspace& other = isForward ? backward : forward;
+        // The backward search follows the arcs up against their direction, which are the down weights
+        const std::vector<int>& weights = isForward ? upWeights : downWeights;
+        IndexedDaryHeap<int, 4>& heap = current.getHeap();
+
+        int minimumNodeValue = heap.extractMinimum();
+        int minimumNodeCost = current.getCost(minimumNodeValue);
+
+        int otherCost = other.getCost(minimumNodeValue);
+        if (otherCost != INT_MAX && static_cast<long long>(minimumNodeCost) + otherCost < bestCost)
+        {
+            bestCost = static_cast<long long>(minimumNodeCost) + otherCost;
+            meetingNode = minimumNodeValue;
+        }
+
+        for (int i = upOffsets[minimumNodeValue]; i < upOffsets[minimumNodeValue + 1]; i++)
+        {
+            if (weights[i] == INT_MAX)
+            {
+                continue;
+            }
+
+            int value = upTargets[i];
+            int newCost = weights[i] + minimumNodeCost;
+
+            if (!heap.wasExtracted(value) && newCost < current.getCost(value))
+            {
+                current.setCost(value, newCost, minimumNodeValue);
+                if (heap.doesNodeExist(value))
+                {
+                    heap.decreaseCost(value, newCost);
+                }
+                else
+                {
+                    heap.insert(value, newCost);
+                }
+            }
+        }
+    }
+
+    if (meetingNode == -1)
+    {
+        return INT_MAX;
+    }
+
+    // Collect the hierarchy's path from the source up to the meeting node and down to the destination
+    std::vector<int> hierarchyPath;
+    for (int node = meetingNode; node != -1; node = forward.getPrevious(node))
+    {
+        hierarchyPath.push_back(node);
+    }
+
+    std::reverse(hierarchyPath.begin(), hierarchyPath.end());
+
+    for (int node = backward.getPrevious(meetingNode); node != -1; node = backward.getPrevious(node))
+    {
+        hierarchyPath.push_back(node);
+    }
+
+    nodes.push_back(source);
+    for (size_t i = 1; i < hierarchyPath.size(); i++)
+    {
+        unpackArc(hierarchyPath[i - 1], hierarchyPath[i], nodes);
+    }
+
+    return static_cast<int>(bestCost);
+}
+
+int CustomizableContractionHierarchy::getArcCount() const
+{
+    return static_cast<int>(upTargets.size());
+}
+
+void CustomizableContractionHierarchy::computeOrder(const std::vector<std::vector<int>>& neighbours)
+{
+    ranks.assign(nodeCount, -1);
+    nodesByRank.assign(nodeCount, -1);
+
+    // Nodes are marked with the part being split, and with the search visiting them
+    std::vector<int> partMarks(nodeCount, -1);
+    std::vector<int> visitMarks(nodeCount, -1);
+    int partId = 0;
+    int visitId = 0;
+
+    // Every part owns the ranks from its first rank on, its separator takes the highest of them
+    std::vector<std::pair<std::vector<int>, int>> parts;
+    std::vector<int> allNodes(nodeCount);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        allNodes[i] = i;
+    }
+
+    parts.push_back(std::make_pair(allNodes, 0));
+
+    std::vector<int> order;
+    while (!parts.empty())
+    {
+        std::vector<int> part = std::move(parts.back().first);
+        int firstRank = parts.back().second;
+        parts.pop_back();
+
+        int size = static_cast<int>(part.size());
+        if (size <= DISSECTION_PART_SIZE)
+        {
+            for (int i = 0; i < size; i++)
+            {
+                ranks[part[i]] = firstRank + i;
+                nodesByRank[firstRank + i] = part[i];
+            }
+
+            continue;
+        }
+
+        for (int node : part)
+        {
+            partMarks[node] = partId;
+        }
+
+        // Breadth first search within the part, returns the nodes in the order of their distance
+        auto search = [&](int start)
+        {
+            visitId++;
+            order.clear();
+            order.push_back(start);
+            visitMarks[start] = visitId;
+
+            for (size_t i = 0; i < order.size(); i++)
+            {
+                for (int neighbour : neighbours[order[i]])
+                {
+                    if (partMarks[neighbour] == partId && visitMarks[neighbour] != visitId)
+                    {
+                        visitMarks[neighbour] = visitId;
+                        order.push_back(neighbour);
+                    }
+                }
+            }
+        };
+
+        search(part[0]);
+
+        if (static_cast<int>(order.size()) < size)
+        {
+            // A disconnected part is split between the reached nodes and the rest, without a separator
+            std::vector<int> rest;
+            for (int node : part)
+            {
+                if (visitMarks[node] != visitId)
+                {
+                    rest.push_back(node);
+                }
+            }
+
+            parts.push_back(std::make_pair(order, firstRank));
+            parts.push_back(std::make_pair(std::move(rest), firstRank + static_cast<int>(order.size())));
+            partId++;
+            continue;
+        }
+
+        // Searching again from the farthest node gives long, thin layers, so the halves have a small boundary
+        search(order.back());
+
+        std::vector<int> first(order.begin(), order.begin() + size / 2);
+        int firstVisitId = ++visitId;
+        for (int node : first)
+        {
+            visitMarks[node] = firstVisitId;
+        }
+
+        // The nodes of the second half adjacent to the first half separate both halves
+        std::vector<int> second;
+        std::vector<int> separator;
+        for (auto it = order.begin() + size / 2; it != order.end(); ++it)
+        {
+            bool isBoundary = false;
+            for (int neighbour : neighbours[*it])
+            {
+                if (partMarks[neighbour] == partId && visitMarks[neighbour] == firstVisitId)
+                {
+                    isBoundary = true;
+                    break;
+                }
+            }
+
+            (isBoundary ? separator : second).push_back(*it);
+        }
+
+        int separatorRank = firstRank + size - static_cast<int>(separator.size());
+        for (size_t i = 0; i < separator.size(); i++)
+        {
+            ranks[separator[i]] = separatorRank + static_cast<int>(i);
+            nodesByRank[separatorRank + i] = separator[i];
+        }
+
+        int secondRank = firstRank + static_cast<int>(first.size());
+        parts.push_back(std::make_pair(std::move(first), firstRank));
+        parts.push_back(std::make_pair(std::move(second), secondRank));
+        partId++;
+    }
+}
+
+void CustomizableContractionHierarchy::buildArcs(const std::vector<std::vector<int>>& neighbours)
+{
+    std::vector<std::vector<int>> up(nodeCount);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        for (int neighbour : neighbours[i])
+        {
+            if (ranks[neighbour] > ranks[i])
+            {
+                up[ranks[i]].push_back(ranks[neighbour]);
+            }
+        }
+    }
+
+    // Eliminating a node connects all its higher neighbours. Its lowest higher neighbour is its parent in the
+    // elimination tree, which is connected to the other ones, so passing them on to the parent is enough.
+    std::vector<int> levels(nodeCount, 0);
+    int levelCount = nodeCount > 0 ? 1 : 0;
+    for (int node = 0; node < nodeCount; node++)
+    {
+        std::vector<int>& arcs = up[node];
+        std::sort(arcs.begin(), arcs.end());
+        arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+
+        if (arcs.empty())
+        {
+            continue;
+        }
+
+        int parent = arcs[0];
+        up[parent].insert(up[parent].end(), arcs.begin() + 1, arcs.end());
+        levels[parent] = std::max(levels[parent], levels[node] + 1);
+        levelCount = std::max(levelCount, levels[parent] + 1);
+    }
+
+    upOffsets.assign(nodeCount + 1, 0);
+    downOffsets.assign(nodeCount + 1, 0);
+    for (int node = 0; node < nodeCount; node++)
+    {
+        upOffsets[node + 1] = upOffsets[node] + static_cast<int>(up[node].size());
+        for (int target : up[node])
+        {
+            downOffsets[target + 1]++;
+        }
+    }
+
+    for (int node = 0; node < nodeCount; node++)
+    {
+        downOffsets[node + 1] += downOffsets[node];
+    }
+
+    upTargets.resize(upOffsets[nodeCount]);
+    downSources.resize(upOffsets[nodeCount]);
+    downArcs.resize(upOffsets[nodeCount]);
+
+    std::vector<int> downPositions(downOffsets.begin(), downOffsets.end() - 1);
+    for (int node = 0; node < nodeCount; node++)
+    {
+        std::copy(up[node].begin(), up[node].end(), upTargets.begin() + upOffsets[node]);
+        for (int arc = upOffsets[node]; arc < upOffsets[node + 1]; arc++)
+        {
+            int position = downPositions[upTargets[arc]]++;
+            downSources[position] = node;
+            downArcs[position] = arc;
+        }
+
+        std::vector<int>().swap(up[node]);
+    }
+
+    // Group the nodes by level
+    levelOffsets.assign(levelCount + 1, 0);
+    for (int node = 0; node < nodeCount; node++)
+    {
+        levelOffsets[levels[node] + 1]++;
+    }
+
+    for (int level = 0; level < levelCount; level++)
+    {
+        levelOffsets[level + 1] += levelOffsets[level];
+    }
+
+    levelNodes.resize(nodeCount);
+    std::vector<int> levelPositions(levelOffsets.begin(), levelOffsets.end() - 1);
+    for (int node = 0; node < nodeCount; node++)
+    {
+        levelNodes[levelPositions[levels[node]]++] = node;
+    }
+}
+
+bool CustomizableContractionHierarchy::areEdgesMapped(const CsrGraph& adjacency) const
+{
+    if (static_cast<int>(edgeOffsets.size()) != nodeCount || adjacency.getEdgeCount() != static_cast<int>(edgeTargets.size()))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        if (adjacency.getEdgeBegin(i) != edgeOffsets[i])
+        {
+            return false;
+        }
+    }
+
+    for (int edge = 0; edge < adjacency.getEdgeCount(); edge++)
+    {
+        if (adjacency.getTarget(edge) != edgeTargets[edge])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void CustomizableContractionHierarchy::mapEdges(const CsrGraph& adjacency)
+{
+    int edgeCount = adjacency.getEdgeCount();
+    edgeOffsets.assign(nodeCount, 0);
+    edgeTargets.assign(edgeCount, -1);
+    edgeArcs.assign(edgeCount, -1);
+    isEdgeUpward.assign(edgeCount, 0);
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        edgeOffsets[i] = adjacency.getEdgeBegin(i);
+
+        int edgeEnd = adjacency.getEdgeEnd(i);
+        for (int edge = adjacency.getEdgeBegin(i); edge < edgeEnd; edge++)
+        {
+            int target = adjacency.getTarget(edge);
+            edgeTargets[edge] = target;
+
+            int from = ranks[i];
+            int to = ranks[target];
+            if (from == to)
+            {
+                continue;
+            }
+
+            // An edge between nodes, which the topology does not connect, was added after the hierarchy was built
+            int lower = std::min(from, to);
+            auto begin = upTargets.begin() + upOffsets[lower];
+            auto end = upTargets.begin() + upOffsets[lower + 1];
+            auto it = std::lower_bound(begin, end, std::max(from, to));
+            if (it == end || *it != std::max(from, to))
+            {
+                throw DijkstraInputException("Graph topology differs from the customizable contraction hierarchy.");
+            }
+
+            edgeArcs[edge] = static_cast<int>(it - upTargets.begin());
+            isEdgeUpward[edge] = from < to;
+        }
+    }
+}
+
+void CustomizableContractionHierarchy::customizeNode(int node)
+{
+    // Every lower neighbour forms a triangle with the node and each of its higher neighbours above the node
+    for (int i = downOffsets[node]; i < downOffsets[node + 1]; i++)
+    {
+        int lower = downSources[i];
+        int lowerArc = downArcs[i];
+        long long toLower = downWeights[lowerArc];
+        long long fromLower = upWeights[lowerArc];
+
+        if (toLower == INT_MAX && fromLower == INT_MAX)
+        {
+            continue;
+        }
+
+        int lowerEnd = upOffsets[lower + 1];
+        int lowerArcOther = lowerArc + 1;
+        int arc = upOffsets[node];
+
+        // Both lists are sorted by rank and the lower neighbour's one is a subset of the node's one
+        for (; lowerArcOther < lowerEnd; lowerArcOther++)
+        {
+            int target = upTargets[lowerArcOther];
+            while (upTargets[arc] != target)
+            {
+                arc++;
+            }
+
+            if (toLower != INT_MAX && upWeights[lowerArcOther] != INT_MAX && toLower + upWeights[lowerArcOther] < upWeights[arc])
+            {
+                upWeights[arc] = static_cast<int>(toLower + upWeights[lowerArcOther]);
+                upMiddles[arc] = lower;
+            }
+
+            if (fromLower != INT_MAX && downWeights[lowerArcOther] != INT_MAX && fromLower + downWeights[lowerArcOther] < downWeights[arc])
+            {
+                downWeights[arc] = static_cast<int>(fromLower + downWeights[lowerArcOther]);
+                downMiddles[arc] = lower;
+            }
+        }
+    }
+}
+
+int CustomizableContractionHierarchy::findArc(int lower, int higher) const
+{
+    auto begin = upTargets.begin() + upOffsets[lower];
+    auto end = upTargets.begin() + upOffsets[lower + 1];
+    auto it = std::lower_bound(begin, end, higher);
+
+    if (it == end || *it != higher)
+    {
+        throw DijkstraException("Customizable contraction hierarchy is missing an edge of a path.");
+    }
+
+    return static_cast<int>(it - upTargets.begin());
+}
+
+void CustomizableContractionHierarchy::unpackArc(int from, int to, std::vector<int>& nodes) const
+{
+    // Unpack with an explicit stack, as shortcuts can be nested deeply
+    std::vector<std::pair<int, int>> stack;
+    stack.push_back(std::make_pair(from, to));
+
+    while (!stack.empty())
+    {
+        std::pair<int, int> arc = stack.back();
+        stack.pop_back();
+
+        int index = findArc(std::min(arc.first, arc.second), std::max(arc.first, arc.second));
+        int middle = arc.first < arc.second ? upMiddles[index] : downMiddles[index];
+        if (middle == -1)
+        {
+            nodes.push_back(nodesByRank[arc.second]);
+        }
+        else
+        {
+            // The first half is unpacked first, so it is pushed last
+            stack.push_back(std::make_pair(middle, arc.second));
+            stack.push_back(std::make_pair(arc.first, middle));
+        }
+    }
+}
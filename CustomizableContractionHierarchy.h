@@ -0,0 +1,148 @@
+#ifndef CUSTOMIZABLECONTRACTIONHIERARCHY_H
+#define CUSTOMIZABLECONTRACTIONHIERARCHY_H
+
+#include "Graph.h"
+#include "ShortestPathEngine.h"
+#include "ShortestPathWorkspace.h"
+#include <vector>
+
+/*!
+ * Represents a customizable contraction hierarchy of a graph and the query engine using it.
+ * The node order (nested dissection) and the shortcut topology only depend on the graph's topology and are computed once.
+ * The weights are applied by customize, which handles the levels of the elimination tree in parallel,
+ * so a change of the edge weights does not require contracting the graph again.
+ * Internally all nodes are numbered by their rank.
+ */
+class CustomizableContractionHierarchy : public ShortestPathEngine
+{
+public:
+    /*!
+     * Constructor, orders the nodes of the specified graph, builds the shortcut topology and customizes it with the graph's weights.
+     * \param graph The graph, which must have non-negative edge weights and outlive the hierarchy.
+     */
+    CustomizableContractionHierarchy(const Graph& graph);
+
+    /*!
+     * Applies the current edge weights of the graph, which must have the topology the hierarchy was built for,
+     * throws DijkstraInputException otherwise. The edges are matched by source and target, regardless of their order.
+     * \param graph The graph the hierarchy was built for, whose edge weights may have changed with Graph::setEdgeWeight.
+     */
+    void customize(const Graph& graph);
+
+    /*!
+     * Calculates the shortest path between source and destination nodes, with all shortcuts unpacked into original edges.
+     * Throws DijkstraInputException if a node does not exist or the graph has changed since the last customization.
+     * \param source The source node.
+     * \param destination The destination node.
+     * \param nodes Filled with the nodes of the shortest path from source to destination, empty if there is no path.
+     * \return The cost of the shortest path, INT_MAX if there is no path.
+     */
+    int findShortestPath(int source, int destination, std::vector<int>& nodes) override;
+
+    /*!
+     * Gets the count of edges of the shortcut topology, each representing both directions between two nodes.
+     * \return The arc count.
+     */
+    int getArcCount() const;
+
+private:
+    /*!
+     * The count of nodes in a part, up to which nested dissection stops splitting.
+     */
+    static const int DISSECTION_PART_SIZE = 8;
+    /*!
+     * The count of nodes in a level of the elimination tree, from which its customization is split among threads.
+     */
+    static const int PARALLEL_LEVEL_SIZE = 1024;
+
+    int nodeCount;
+    /*!
+     * The graph and its version, when the hierarchy was last customized.
+     */
+    const Graph& graph;
+    unsigned long long graphVersion;
+    std::vector<int> ranks;
+    std::vector<int> nodesByRank;
+
+    /*!
+     * The arcs from every node to its higher ranked neighbours, sorted by rank, in compressed sparse row form.
+     */
+    std::vector<int> upOffsets;
+    std::vector<int> upTargets;
+    /*!
+     * The arcs to every node from its lower ranked neighbours, holding the neighbour and the arc index.
+     */
+    std::vector<int> downOffsets;
+    std::vector<int> downSources;
+    std::vector<int> downArcs;
+
+    /*!
+     * The weight and the bypassed node of every arc towards the higher ranked node (up) and back (down).
+     */
+    std::vector<int> upWeights;
+    std::vector<int> downWeights;
+    std::vector<int> upMiddles;
+    std::vector<int> downMiddles;
+
+    /*!
+     * The arc of every edge of the graph's adjacency snapshot and whether the edge leads to the higher ranked node.
+     * The offsets and targets of the snapshot identify the edges by source and target, so a reordered snapshot is detected.
+     */
+    std::vector<int> edgeOffsets;
+    std::vector<int> edgeTargets;
+    std::vector<int> edgeArcs;
+    std::vector<char> isEdgeUpward;
+
+    /*!
+     * The nodes grouped by their level in the elimination tree, a node's lower neighbours are all on lower levels.
+     */
+    std::vector<int> levelOffsets;
+    std::vector<int> levelNodes;
+
+    ShortestPathWorkspace forward;
+    ShortestPathWorkspace backward;
+
+    /*!
+     * Computes the nested dissection order of the graph's undirected topology.
+     * \param neighbours The neighbours of every node.
+     */
+    void computeOrder(const std::vector<std::vector<int>>& neighbours);
+    /*!
+     * Builds the arcs of the chordal supergraph, given by eliminating the nodes in rank order.
+     * \param neighbours The neighbours of every node.
+     */
+    void buildArcs(const std::vector<std::vector<int>>& neighbours);
+    /*!
+     * Checks whether the edges of a snapshot are the ones mapped to the arcs, in the same order.
+     * \param adjacency The graph's adjacency snapshot.
+     * \return Whether the mapping holds for the snapshot.
+     */
+    bool areEdgesMapped(const CsrGraph& adjacency) const;
+    /*!
+     * Maps the edges of a snapshot to their arcs by source and target, so customization does not need to search them,
+     * throws DijkstraInputException if an edge connects nodes, which the shortcut topology does not.
+     * \param adjacency The graph's adjacency snapshot.
+     */
+    void mapEdges(const CsrGraph& adjacency);
+    /*!
+     * Computes the shortest paths through lower triangles for all arcs of a node.
+     * \param node The node's rank.
+     */
+    void customizeNode(int node);
+    /*!
+     * Returns the arc between two nodes.
+     * \param lower The rank of the lower ranked node.
+     * \param higher The rank of the higher ranked node.
+     * \return The arc index.
+     */
+    int findArc(int lower, int higher) const;
+    /*!
+     * Appends the original nodes of an arc to a path, replacing shortcuts by the arcs they bypass.
+     * \param from The rank of the arc's source, which has already been appended.
+     * \param to The rank of the arc's destination.
+     * \param nodes The path of original node values.
+     */
+    void unpackArc(int from, int to, std::vector<int>& nodes) const;
+};
+
+#endif // CUSTOMIZABLECONTRACTIONHIERARCHY_H
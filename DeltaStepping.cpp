@@ -0,0 +1,249 @@
+#include "DeltaStepping.h"
+#include "DijkstraException.h"
+#include "DijkstraInputException.h"
+#include <algorithm>
+#include <thread>
+
+DeltaStepping::DeltaStepping(const Graph& graph, int delta, int threadCount)
+    : graph(graph)
+{
+    // A settled bucket is never entered again, which needs non-negative weights
+    if (graph.hasNegativeEdgeWeights())
+    {
+        throw DijkstraException("Delta-stepping requires non-negative edge weights.");
+    }
+
+    this->nodeCount = graph.getCurrentNodeCount();
+    this->graphVersion = graph.getVersion();
+    this->threadCount = threadCount > 0 ? threadCount : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    this->delta = 0;
+    this->maximumEdgeWeight = 0;
+
+    const CsrGraph& adjacency = graph.freeze();
+    offsets.assign(nodeCount + 1, 0);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        offsets[i + 1] = adjacency.getEdgeEnd(i);
+    }
+
+    targets.resize(adjacency.getEdgeCount());
+    weights.resize(adjacency.getEdgeCount());
+    for (int edge = 0; edge < adjacency.getEdgeCount(); edge++)
+    {
+        targets[edge] = adjacency.getTarget(edge);
+        weights[edge] = adjacency.getWeight(edge);
+        maximumEdgeWeight = std::max(maximumEdgeWeight, weights[edge]);
+    }
+
+    states.reset(new std::atomic<unsigned long long>[nodeCount]);
+    frontierStamps.assign(nodeCount, -1);
+    settledStamps.assign(nodeCount, -1);
+    decreasedNodes.resize(this->threadCount);
+
+    setDelta(delta);
+}
+
+int DeltaStepping::getDelta() const
+{
+    return delta;
+}
+
+void DeltaStepping::setDelta(int delta)
+{
+    if (delta <= 0)
+    {
+        // About one light edge per node keeps the phases short without running many of them
+        int averageDegree = nodeCount > 0 ? std::max(1, static_cast<int>(targets.size() / nodeCount)) : 1;
+        delta = std::max(1, maximumEdgeWeight / averageDegree);
+    }
+
+    this->delta = delta;
+
+    // Move the light edges of every node to the front
+    lightEnds.resize(nodeCount);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        int lightEnd = offsets[i];
+        for (int edge = offsets[i]; edge < offsets[i + 1]; edge++)
+        {
+            if (weights[edge] <= delta)
+            {
+                std::swap(targets[edge], targets[lightEnd]);
+                std::swap(weights[edge], weights[lightEnd]);
+                lightEnd++;
+            }
+        }
+
+        lightEnds[i] = lightEnd;
+    }
+
+    // The tentative costs span at most maximumEdgeWeight beyond the current bucket, so this many buckets never overlap
+    buckets.assign(maximumEdgeWeight / delta + 2, std::vector<int>());
+}
+
+void DeltaStepping::calculateShortestPathTree(int source, std::vector<int>& costs, std::vector<int>& path)
+{
+    if (source < 0 || source >= nodeCount)
+    {
+        throw DijkstraInputException("Source does not exist in the graph.");
+    }
+
+    // The copied edges do not know about edges added or reweighted afterwards
+    if (graph.getVersion() != graphVersion)
+    {
+        throw DijkstraInputException("Graph has changed since its edges were copied for delta-stepping.");
+    }
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        states[i].store(UNREACHED, std::memory_order_relaxed);
+        frontierStamps[i] = -1;
+        settledStamps[i] = -1;
+    }
+
+    for (std::vector<int>& bucket : buckets)
+    {
+        bucket.clear();
+    }
+
+    states[source].store(0, std::memory_order_relaxed);
+    buckets[0].push_back(source);
+
+    long long bucketCount = static_cast<long long>(buckets.size());
+    long long current = 0;
+    long long phase = 0;
+    std::vector<int> frontier;
+    std::vector<int> settled;
+
+    while (true)
+    {
+        // Find the next bucket with entries, if all are empty every reachable node is settled
+        long long skipped = 0;
+        while (skipped < bucketCount && buckets[(current + skipped) % bucketCount].empty())
+        {
+            skipped++;
+        }
+
+        if (skipped == bucketCount)
+        {
+            break;
+        }
+
+        current += skipped;
+        std::vector<int>& bucket = buckets[current % bucketCount];
+        settled.clear();
+
+        // Light edges may lead back into the current bucket, so repeat until it stays empty
+        while (!bucket.empty())
+        {
+            frontier.clear();
+            phase++;
+            for (int node : bucket)
+            {
+                long long cost = static_cast<long long>(states[node].load(std::memory_order_relaxed) >> 32);
+                if (cost / delta != current || frontierStamps[node] == phase)
+                {
+                    continue;
+                }
+
+                frontierStamps[node] = phase;
+                frontier.push_back(node);
+
+                if (settledStamps[node] != current)
+                {
+                    settledStamps[node] = current;
+                    settled.push_back(node);
+                }
+            }
+
+            bucket.clear();
+            relax(frontier, true);
+        }
+
+        // Heavy edges lead into later buckets, so they are relaxed once per settled node
+        relax(settled, false);
+        current++;
+    }
+
+    costs.resize(nodeCount);
+    path.resize(nodeCount);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        unsigned long long state = states[i].load(std::memory_order_relaxed);
+        costs[i] = static_cast<int>(state >> 32);
+        path[i] = static_cast<int>(state & 0xFFFFFFFFULL) - 1;
+    }
+}
+
+void DeltaStepping::relax(const std::vector<int>& nodes, bool isLight)
+{
+    for (std::vector<int>& decreased : decreasedNodes)
+    {
+        decreased.clear();
+    }
+
+    if (threadCount == 1 || nodes.size() < static_cast<size_t>(PARALLEL_PHASE_SIZE))
+    {
+        relaxRange(nodes, 0, nodes.size(), isLight, decreasedNodes[0]);
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        size_t chunkSize = (nodes.size() + threadCount - 1) / threadCount;
+        for (int i = 0; i < threadCount; i++)
+        {
+            size_t begin = std::min(nodes.size(), i * chunkSize);
+            size_t end = std::min(nodes.size(), begin + chunkSize);
+            threads.emplace_back(&DeltaStepping::relaxRange, this, std::cref(nodes), begin, end, isLight, std::ref(decreasedNodes[i]));
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    // File the decreased nodes by their final cost of the phase, a node decreased by several threads is filed more than once
+    long long bucketCount = static_cast<long long>(buckets.size());
+    for (const std::vector<int>& decreased : decreasedNodes)
+    {
+        for (int node : decreased)
+        {
+            long long cost = static_cast<long long>(states[node].load(std::memory_order_relaxed) >> 32);
+            buckets[(cost / delta) % bucketCount].push_back(node);
+        }
+    }
+}
+
+void DeltaStepping::relaxRange(const std::vector<int>& nodes, size_t begin, size_t end, bool isLight, std::vector<int>& decreased)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        int node = nodes[i];
+        long long cost = static_cast<long long>(states[node].load(std::memory_order_relaxed) >> 32);
+        int edgeBegin = isLight ? offsets[node] : lightEnds[node];
+        int edgeEnd = isLight ? lightEnds[node] : offsets[node + 1];
+
+        for (int edge = edgeBegin; edge < edgeEnd; edge++)
+        {
+            long long newCost = cost + weights[edge];
+            if (newCost >= INT_MAX)
+            {
+                continue;
+            }
+
+            // Lower the packed state unless another thread has already found a path at most as short
+            std::atomic<unsigned long long>& state = states[targets[edge]];
+            unsigned long long newState = (static_cast<unsigned long long>(newCost) << 32) | static_cast<unsigned long long>(node + 1);
+            unsigned long long oldState = state.load(std::memory_order_relaxed);
+            while ((oldState >> 32) > static_cast<unsigned long long>(newCost))
+            {
+                if (state.compare_exchange_weak(oldState, newState, std::memory_order_relaxed))
+                {
+                    decreased.push_back(targets[edge]);
+                    break;
+                }
+            }
+        }
+    }
+}
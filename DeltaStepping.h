@@ -0,0 +1,109 @@
+#ifndef DELTASTEPPING_H
+#define DELTASTEPPING_H
+
+#include "Graph.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/*!
+ * Represents a parallel single source shortest path engine using delta-stepping.
+ * The tentative costs are kept in buckets of width delta. The nodes of the lowest bucket are settled together:
+ * their light edges (weight up to delta) are relaxed in parallel until the bucket stays empty,
+ * then their heavy edges are relaxed once, as these can not lead back into the same bucket.
+ * A small delta approaches Dijkstra's algorithm, a large one approaches Bellman-Ford with more parallel work per phase.
+ */
+class DeltaStepping
+{
+public:
+    /*!
+     * Constructor, copies the adjacency of the specified graph with every node's light edges before its heavy ones.
+     * \param graph The graph, which must have non-negative edge weights and outlive the engine.
+     * \param delta The bucket width, 0 to derive it from the maximum edge weight and the average degree.
+     * \param threadCount The count of threads, 0 for one per hardware thread.
+     */
+    DeltaStepping(const Graph& graph, int delta = 0, int threadCount = 0);
+
+    /*!
+     * Calculates the shortest paths from the source to all nodes, like Graph::calculateShortestPathTree.
+     * Throws DijkstraInputException if the source does not exist or the graph has changed since the engine was created.
+     * \param source The source node.
+     * \param costs Filled with the cost of the shortest path to every node, INT_MAX for unreachable nodes.
+     * \param path Filled with the previous node on the shortest path to every node, -1 for the source and unreachable nodes.
+     */
+    void calculateShortestPathTree(int source, std::vector<int>& costs, std::vector<int>& path);
+
+    /*!
+     * Gets the bucket width.
+     * \return The bucket width.
+     */
+    int getDelta() const;
+    /*!
+     * Sets the bucket width, which splits the edges into light and heavy ones again.
+     * \param delta The bucket width, 0 to derive it from the maximum edge weight and the average degree.
+     */
+    void setDelta(int delta);
+
+private:
+    /*!
+     * The count of nodes in a phase, from which the relaxation is split among threads.
+     */
+    static const int PARALLEL_PHASE_SIZE = 4096;
+    /*!
+     * The tentative state of an unreached node, the cost in the upper and the previous node plus one in the lower half.
+     */
+    static constexpr unsigned long long UNREACHED = static_cast<unsigned long long>(INT_MAX) << 32;
+
+    int nodeCount;
+    /*!
+     * The graph and its version, when its edges were copied.
+     */
+    const Graph& graph;
+    unsigned long long graphVersion;
+    int threadCount;
+    int delta;
+    int maximumEdgeWeight;
+
+    /*!
+     * The adjacency in compressed sparse row form, the light edges of a node end at lightEnds[node].
+     */
+    std::vector<int> offsets;
+    std::vector<int> lightEnds;
+    std::vector<int> targets;
+    std::vector<int> weights;
+
+    /*!
+     * The tentative cost and previous node of every node, packed to be updated by a single compare and swap.
+     */
+    std::unique_ptr<std::atomic<unsigned long long>[]> states;
+
+    /*!
+     * The nodes of every bucket, reused circularly, as all tentative costs lie within maximumEdgeWeight of the current bucket.
+     * A node may be left in a bucket its cost has fallen out of, such entries are skipped.
+     */
+    std::vector<std::vector<int>> buckets;
+    std::vector<long long> frontierStamps;
+    std::vector<long long> settledStamps;
+    /*!
+     * The nodes, whose cost each thread has decreased during a phase.
+     */
+    std::vector<std::vector<int>> decreasedNodes;
+
+    /*!
+     * Relaxes the light or heavy edges of the specified nodes, in parallel for large phases, and files the decreased nodes into buckets.
+     * \param nodes The nodes.
+     * \param isLight Whether the light edges are relaxed.
+     */
+    void relax(const std::vector<int>& nodes, bool isLight);
+    /*!
+     * Relaxes the light or heavy edges of a range of nodes.
+     * \param nodes The nodes.
+     * \param begin The index of the range's first node.
+     * \param end The index after the range's last node.
+     * \param isLight Whether the light edges are relaxed.
+     * \param decreased Filled with the nodes, whose cost decreased.
+     */
+    void relaxRange(const std::vector<int>& nodes, size_t begin, size_t end, bool isLight, std::vector<int>& decreased);
+};
+
+#endif // DELTASTEPPING_H
@@ -0,0 +1,21 @@
+#include "DialBucketQueue.h"
+
+DialBucketQueue::DialBucketQueue(int maximumEdgeWeight)
+{
+    this->buckets.resize(maximumEdgeWeight + 1);
+    this->currentCost = 0;
+    this->currentBucket = 0;
+    this->nodesCount = 0;
+}
+
+void DialBucketQueue::clear()
+{
+    for (std::vector<int>& bucket : buckets)
+    {
+        bucket.clear();
+    }
+
+    currentCost = 0;
+    currentBucket = 0;
+    nodesCount = 0;
+}
@@ -0,0 +1,97 @@
+#ifndef DIALBUCKETQUEUE_H
+#define DIALBUCKETQUEUE_H
+
+#include <vector>
+
+/*!
+ * Represents a monotone priority queue of nodes with non-negative integer costs (Dial's algorithm).
+ * Nodes are kept in a circular array of buckets, one per cost modulo (maximum edge weight + 1),
+ * which works because all costs in the queue lie in [minimum, minimum + maximum edge weight].
+ * Decreasing a node's cost is done by inserting it again, outdated entries have to be skipped by the caller.
+ */
+class DialBucketQueue
+{
+public:
+    /*!
+     * Constructor - creates an empty queue for the given maximum edge weight
+     * \param maximumEdgeWeight The maximum weight of an edge in the searched graph
+     */
+    DialBucketQueue(int maximumEdgeWeight);
+
+    /*!
+     * Function to determine if the queue is empty
+     * \return bool If the queue is empty
+     */
+    bool isEmpty() const;
+    /*!
+     * Function used to insert a node. The cost must not be smaller than the last extracted cost.
+     * \param value Node's value
+     * \param cost Node's cost
+     */
+    void insert(int value, int cost);
+    /*!
+     * Function used to extract a node with the minimum cost
+     * \return int The value of the extracted node
+     */
+    int extractMinimum();
+    /*!
+     * Function used to return the cost of the last extracted node
+     * \return int The cost of the last extracted node
+     */
+    int getLastExtractedCost() const;
+
+    /*!
+     * Function used to remove all nodes, the buckets' memory is kept for the next search
+     */
+    void clear();
+
+private:
+    std::vector<std::vector<int>> buckets;
+    int currentCost;
+    int currentBucket;
+    int nodesCount;
+};
+
+inline bool DialBucketQueue::isEmpty() const
+{
+    return nodesCount == 0;
+}
+
+inline void DialBucketQueue::insert(int value, int cost)
+{
+    // Costs in the queue span at most buckets.size() consecutive values, so they never share a bucket
+    int bucket = currentBucket + (cost - currentCost);
+    int bucketsCount = static_cast<int>(buckets.size());
+    if (bucket >= bucketsCount)
+    {
+        bucket -= bucketsCount;
+    }
+
+    buckets[bucket].push_back(value);
+    nodesCount++;
+}
+
+inline int DialBucketQueue::extractMinimum()
+{
+    int bucketsCount = static_cast<int>(buckets.size());
+
+    // Advance to the next non-empty bucket
+    while (buckets[currentBucket].empty())
+    {
+        currentCost++;
+        currentBucket = currentBucket + 1 == bucketsCount ? 0 : currentBucket + 1;
+    }
+
+    int value = buckets[currentBucket].back();
+    buckets[currentBucket].pop_back();
+    nodesCount--;
+
+    return value;
+}
+
+inline int DialBucketQueue::getLastExtractedCost() const
+{
+    return currentCost;
+}
+
+#endif // DIALBUCKETQUEUE_H
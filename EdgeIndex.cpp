@@ -0,0 +1,103 @@
+#include "EdgeIndex.h"
+
+EdgeIndex::EdgeIndex()
+{
+    this->size = 0;
+    this->shift = 64;
+}
+
+void EdgeIndex::clear()
+{
+    std::vector<unsigned long long>().swap(slots);
+    size = 0;
+    shift = 64;
+}
+
+void EdgeIndex::reserve(size_t edgeCount)
+{
+    // Keep the table at most three quarters full after the edges are added
+    size_t capacity = MINIMUM_CAPACITY;
+    while (capacity / 4 * 3 < edgeCount)
+    {
+        capacity *= 2;
+    }
+
+    if (capacity > slots.size())
+    {
+        rehash(capacity);
+    }
+}
+
+bool EdgeIndex::insert(int source, int destination)
+{
+    if ((size + 1) > slots.size() / 4 * 3)
+    {
+        rehash(slots.empty() ? MINIMUM_CAPACITY : slots.size() * 2);
+    }
+
+    unsigned long long key = packKey(source, destination);
+    size_t slot = findSlot(key);
+    if (slots[slot] == key)
+    {
+        return false;
+    }
+
+    slots[slot] = key;
+    size++;
+    return true;
+}
+
+bool EdgeIndex::contains(int source, int destination) const
+{
+    if (slots.empty() || source < 0 || destination < 0)
+    {
+        return false;
+    }
+
+    unsigned long long key = packKey(source, destination);
+    return slots[findSlot(key)] == key;
+}
+
+size_t EdgeIndex::getSize() const
+{
+    return size;
+}
+
+unsigned long long EdgeIndex::packKey(int source, int destination)
+{
+    return (static_cast<unsigned long long>(source) << 32) | static_cast<unsigned int>(destination);
+}
+
+size_t EdgeIndex::findSlot(unsigned long long key) const
+{
+    // Fibonacci hashing spreads the consecutive node numbers of a source's edges over the whole table
+    size_t mask = slots.size() - 1;
+    size_t slot = static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> shift);
+
+    while (slots[slot] != key && slots[slot] != EMPTY_KEY)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+void EdgeIndex::rehash(size_t capacity)
+{
+    std::vector<unsigned long long> oldSlots(capacity, EMPTY_KEY);
+    oldSlots.swap(slots);
+
+    shift = 64;
+    for (size_t i = capacity; i > 1; i /= 2)
+    {
+        shift--;
+    }
+
+    for (unsigned long long key : oldSlots)
+    {
+        if (key != EMPTY_KEY)
+        {
+            slots[findSlot(key)] = key;
+        }
+    }
+}
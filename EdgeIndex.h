@@ -0,0 +1,87 @@
+#ifndef EDGEINDEX_H
+#define EDGEINDEX_H
+
+#include <cstddef>
+#include <vector>
+
+/*!
+ * Represents a set of directed edges, keyed by their source and destination, for duplicate checks in constant expected time.
+ * The pairs are packed into 64 bit keys in an open addressing table with linear probing, which takes 8 bytes per slot
+ * and stays at most three quarters full. Edges can not be removed, like in the graph.
+ */
+class EdgeIndex
+{
+public:
+    /*!
+     * Default constructor, creates an empty index.
+     */
+    EdgeIndex();
+
+    /*!
+     * Reserves room for the specified count of edges, so adding them does not grow the table.
+     * \param edgeCount The count of edges.
+     */
+    void reserve(size_t edgeCount);
+    /*!
+     * Adds an edge unless it is indexed already.
+     * \param source The edge's source, which must not be negative.
+     * \param destination The edge's destination, which must not be negative.
+     * \return Whether the edge was added, false if it was indexed already.
+     */
+    bool insert(int source, int destination);
+    /*!
+     * Checks whether an edge is indexed.
+     * \param source The edge's source.
+     * \param destination The edge's destination.
+     * \return Whether the edge is indexed.
+     */
+    bool contains(int source, int destination) const;
+    /*!
+     * Removes all edges and frees the table.
+     */
+    void clear();
+
+    /*!
+     * Gets the count of indexed edges.
+     * \return The edge count.
+     */
+    size_t getSize() const;
+
+private:
+    /*!
+     * The key of an empty slot, which no edge with non-negative ends packs to.
+     */
+    static constexpr unsigned long long EMPTY_KEY = ~0ULL;
+    /*!
+     * The slot count of the first table, which grows by doubling.
+     */
+    static constexpr size_t MINIMUM_CAPACITY = 16;
+
+    std::vector<unsigned long long> slots;
+    size_t size;
+    /*!
+     * The shift, which maps a hash to a slot, 64 minus the binary logarithm of the slot count.
+     */
+    int shift;
+
+    /*!
+     * Packs an edge into its key.
+     * \param source The edge's source.
+     * \param destination The edge's destination.
+     * \return The key.
+     */
+    static unsigned long long packKey(int source, int destination);
+    /*!
+     * Finds the slot of a key, or the empty slot its probe sequence ends at.
+     * \param key The key.
+     * \return The slot's index.
+     */
+    size_t findSlot(unsigned long long key) const;
+    /*!
+     * Replaces the table with one of the specified slot count and inserts all keys again.
+     * \param capacity The new slot count, a power of two.
+     */
+    void rehash(size_t capacity);
+};
+
+#endif // EDGEINDEX_H
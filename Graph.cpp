@@ -1,54 +1,139 @@
 #include "Graph.h"
 #include "DijkstraInputException.h"
-#include "MinHeap.h"
+#include "GraphFile.h"
 #include "GraphWidget.h"
+#include "NodeOrdering.h"
 #include <QTimer>
+#include <algorithm>
 
 Graph::Graph(int nodeCount, int edgeCount)
 {
     this->nodeCount = nodeCount;
     this->allEdgeCount = edgeCount;
+    this->currentEdgeCount = 0;
+    this->version = 0;
+    this->isCsrOutdated = true;
+    this->isReverseCsrOutdated = true;
+    this->isOrderedCsrOutdated = true;
+    this->maximumEdgeWeight = 0;
+    this->negativeEdgeWeights = false;
+    this->priorityQueueType = PriorityQueueType::Automatic;
 
     head = new Node*[nodeCount];
+    reverseHead = new Node*[nodeCount];
+
+    //Reserve the index of the announced edges, so it does not grow while the graph is filled.
+    //The count comes from the user or a file, so it is capped by the edges the nodes can hold and by a fixed maximum, beyond which the index grows with the edges.
+    if (edgeCount > 0 && nodeCount > 1)
+    {
+        long long possibleEdgeCount = static_cast<long long>(nodeCount) * (nodeCount - 1);
+        edgeIndex.reserve(static_cast<size_t>(std::min({ static_cast<long long>(edgeCount), possibleEdgeCount, MAXIMUM_RESERVED_EDGE_COUNT })));
+    }
 
     //Initialize the head node for every edge.
     for(int i = 0; i < nodeCount; i++)
     {
         head[i] = nullptr;
+        reverseHead[i] = nullptr;
     }
 }
 
+Graph::Graph(std::unique_ptr<GraphFile> file)
+{
+    this->nodeCount = file->getAdjacency().getNodeCount();
+    this->allEdgeCount = file->getAdjacency().getEdgeCount();
+    this->currentEdgeCount = allEdgeCount;
+    this->version = 0;
+    this->maximumEdgeWeight = file->getMaximumEdgeWeight();
+    this->negativeEdgeWeights = file->hasNegativeEdgeWeights();
+    this->priorityQueueType = PriorityQueueType::Automatic;
+
+    //The snapshot is a view of the file, the adjacency lists are only built once the graph is changed.
+    this->csr = file->getAdjacency();
+    this->isCsrOutdated = false;
+    this->isReverseCsrOutdated = true;
+    this->isOrderedCsrOutdated = true;
+    this->mappedFile = std::move(file);
+
+    head = nullptr;
+    reverseHead = nullptr;
+}
+
 bool Graph::doesEdgeExist(int source, int destination) const
 {
-    Node* sourceHead = head[source];
+    return edgeIndex.contains(source, destination);
+}
 
-    //Go through all the nodes, leading from the specified edge's source
-    //and check whether the specified edge's destination is present as any of the nodes' value.
-    while (sourceHead != nullptr)
-    {
-        int value = sourceHead->getValue();
+bool Graph::doesNodeExist(int value) const
+{
+    return nodeCount > value && value >= 0;
+}
 
-        if (value == destination)
-        {
-            return true;
-        }
+void Graph::addEdge(const Edge& edge)
+{
+    restoreAdjacencyLists();
+    validateEdge(edge);
 
-        sourceHead = sourceHead->getNextNode();
+    //Check whether the edge exists already, and index it otherwise.
+    if (!edgeIndex.insert(edge.getSource(), edge.getDestination()))
+    {
+        throw DijkstraInputException("Edge already exists.");
     }
 
-    return false;
+    linkEdge(edge);
+    version++;
+
+    setCurrentEdgeCount(++currentEdgeCount);
 }
 
-bool Graph::doesNodeExist(int value) const
+void Graph::addEdges(const Edge* edges, int edgeCount, bool isTrusted)
 {
-    return nodeCount > value && value >= 0;
+    if (edgeCount <= 0)
+    {
+        return;
+    }
+
+    restoreAdjacencyLists();
+
+    if (!isTrusted)
+    {
+        //Check the whole batch before adding any edge, so an invalid edge leaves the graph unchanged.
+        EdgeIndex batchIndex;
+        batchIndex.reserve(static_cast<size_t>(edgeCount));
+
+        for (int i = 0; i < edgeCount; i++)
+        {
+            validateEdge(edges[i]);
+
+            //The edge may exist in the graph or earlier in the batch.
+            if (edgeIndex.contains(edges[i].getSource(), edges[i].getDestination())
+                    || !batchIndex.insert(edges[i].getSource(), edges[i].getDestination()))
+            {
+                throw DijkstraInputException("Edge already exists.");
+            }
+        }
+    }
+
+    //Every edge takes a node in the adjacency list of its source and one in the reverse list of its destination.
+    edgeIndex.reserve(edgeIndex.getSize() + static_cast<size_t>(edgeCount));
+    nodeArena.reserve(2 * static_cast<size_t>(edgeCount));
+
+    for (int i = 0; i < edgeCount; i++)
+    {
+        //Trusted edges are indexed as well, so later single edges are still checked against them.
+        edgeIndex.insert(edges[i].getSource(), edges[i].getDestination());
+        linkEdge(edges[i]);
+    }
+
+    version++;
+    currentEdgeCount += edgeCount;
+    setCurrentEdgeCount(currentEdgeCount);
 }
 
-void Graph::addEdge(Edge* edge)
+void Graph::validateEdge(const Edge& edge) const
 {
-    int edgeSource = edge->getSource();
-    int edgeDestination = edge->getDestination();
-    int edgeWeight = edge->getWeight();
+    int edgeSource = edge.getSource();
+    int edgeDestination = edge.getDestination();
 
     //Check for out of bounds edge source.
     if (edgeSource < 0 || edgeSource >= nodeCount)
@@ -67,21 +152,207 @@ void Graph::addEdge(Edge* edge)
     {
         throw DijkstraInputException("No self loops allowed.");
     }
+}
 
-    //Check whether the edge exists already.
-    if (doesEdgeExist(edgeSource, edgeDestination))
-    {
-        throw DijkstraInputException("Edge already exists.");
-    }
+void Graph::linkEdge(const Edge& edge)
+{
+    int edgeSource = edge.getSource();
+    int edgeDestination = edge.getDestination();
+    int edgeWeight = edge.getWeight();
 
     //Create a new node with the new edge's destination as value, new edge's weight as cost,
     //and new edge's source as head.
-    Node* newNode = new Node(edgeDestination, edgeWeight, head[edgeSource]);
+    Node* newNode = nodeArena.create(edgeDestination, edgeWeight, head[edgeSource]);
 
     //Set the head to the new node.
     head[edgeSource] = newNode;
+    isCsrOutdated = true;
+    isOrderedCsrOutdated = true;
 
-    setCurrentEdgeCount(++currentEdgeCount);
+    //Index the edge as an incoming edge of its destination as well.
+    reverseHead[edgeDestination] = nodeArena.create(edgeSource, edgeWeight, reverseHead[edgeDestination]);
+    isReverseCsrOutdated = true;
+
+    //Keep track of the weights' range, which determines the priority queue used for the shortest path calculation.
+    if (edgeWeight > maximumEdgeWeight)
+    {
+        maximumEdgeWeight = edgeWeight;
+    }
+
+    if (edgeWeight < 0)
+    {
+        negativeEdgeWeights = true;
+    }
+}
+
+void Graph::restoreAdjacencyLists()
+{
+    if (head != nullptr)
+    {
+        return;
+    }
+
+    head = new Node*[nodeCount];
+    reverseHead = new Node*[nodeCount];
+    for (int i = 0; i < nodeCount; i++)
+    {
+        head[i] = nullptr;
+        reverseHead[i] = nullptr;
+    }
+
+    //The edges are linked without checks, like trusted ones, GraphFile::verify checks the file's and the compressed ones were checked before.
+    CsrGraph decompressedAdjacency;
+    if (compressedAdjacency)
+    {
+        decompressedAdjacency = decompressAdjacency();
+    }
+
+    const CsrGraph& adjacency = mappedFile ? mappedFile->getAdjacency() : decompressedAdjacency;
+    edgeIndex.reserve(static_cast<size_t>(adjacency.getEdgeCount()));
+    nodeArena.reserve(2 * static_cast<size_t>(adjacency.getEdgeCount()));
+
+    //Linking prepends, so every node's edges are linked from the last one, which keeps the snapshot's edge order.
+    for (int source = 0; source < nodeCount; source++)
+    {
+        for (int edge = adjacency.getEdgeEnd(source) - 1; edge >= adjacency.getEdgeBegin(source); edge--)
+        {
+            edgeIndex.insert(source, adjacency.getTarget(edge));
+            linkEdge(Edge(source, adjacency.getTarget(edge), adjacency.getWeight(edge)));
+        }
+    }
+
+    //The snapshots may view the file, so they are rebuilt from the lists before it is released.
+    isCsrOutdated = true;
+    isReverseCsrOutdated = true;
+    isOrderedCsrOutdated = true;
+    csr = CsrGraph();
+    reverseCsr = CsrGraph();
+    orderedCsr = CsrGraph();
+    mappedFile.reset();
+    compressedAdjacency.reset();
+}
+
+void Graph::compressAdjacency()
+{
+    if (compressedAdjacency)
+    {
+        return;
+    }
+
+    //The queries decode the compressed adjacency instead of the ordered snapshot, so it is compressed in the nodes' order.
+    compressedAdjacency.reset(new CompressedCsrGraph(freezeOrdered()));
+
+    //Free everything, which holds the uncompressed edges, the snapshots are decompressed again on demand.
+    delete[] head;
+    delete[] reverseHead;
+    head = nullptr;
+    reverseHead = nullptr;
+    nodeArena.clear();
+    edgeIndex.clear();
+
+    isCsrOutdated = true;
+    isReverseCsrOutdated = true;
+    isOrderedCsrOutdated = true;
+    csr = CsrGraph();
+    reverseCsr = CsrGraph();
+    orderedCsr = CsrGraph();
+    mappedFile.reset();
+}
+
+bool Graph::isAdjacencyCompressed() const
+{
+    return compressedAdjacency != nullptr;
+}
+
+void Graph::reorderNodes(NodeOrdering::Type type)
+{
+    //The order is computed from the original ids, which the snapshot keeps regardless of the current order.
+    std::vector<int> order = NodeOrdering::computeOrder(freeze(), type);
+
+    rankedNodes.clear();
+    nodeRanks.clear();
+    if (type != NodeOrdering::Type::Original)
+    {
+        rankedNodes.swap(order);
+        nodeRanks.resize(nodeCount);
+        for (int i = 0; i < nodeCount; i++)
+        {
+            nodeRanks[rankedNodes[i]] = i;
+        }
+    }
+
+    isOrderedCsrOutdated = true;
+    orderedCsr = CsrGraph();
+
+    //A compressed adjacency is stored in the nodes' order, so it is compressed again, the snapshot stays valid.
+    if (compressedAdjacency)
+    {
+        compressedAdjacency.reset(new CompressedCsrGraph(freezeOrdered()));
+        isOrderedCsrOutdated = true;
+        orderedCsr = CsrGraph();
+    }
+}
+
+bool Graph::isReordered() const
+{
+    return !nodeRanks.empty();
+}
+
+CsrGraph Graph::decompressAdjacency() const
+{
+    CsrGraph adjacency = compressedAdjacency->decompress();
+    return nodeRanks.empty() ? adjacency : NodeOrdering::permute(adjacency, rankedNodes);
+}
+
+void Graph::setEdgeWeight(int source, int destination, int weight)
+{
+    restoreAdjacencyLists();
+
+    Node* edgeNode = nullptr;
+    if (doesNodeExist(source))
+    {
+        for (edgeNode = head[source]; edgeNode != nullptr && edgeNode->getValue() != destination; edgeNode = edgeNode->getNextNode())
+        {
+        }
+    }
+
+    if (edgeNode == nullptr)
+    {
+        throw DijkstraInputException("Edge does not exist.");
+    }
+
+    edgeNode->setCost(weight);
+
+    //Update the incoming edge of the destination as well.
+    for (Node* reverseNode = reverseHead[destination]; reverseNode != nullptr; reverseNode = reverseNode->getNextNode())
+    {
+        if (reverseNode->getValue() == source)
+        {
+            reverseNode->setCost(weight);
+            break;
+        }
+    }
+
+    isCsrOutdated = true;
+    isReverseCsrOutdated = true;
+    isOrderedCsrOutdated = true;
+    version++;
+
+    //The maximum is only an upper bound afterwards, which is still valid for sizing Dial's buckets.
+    if (weight > maximumEdgeWeight)
+    {
+        maximumEdgeWeight = weight;
+    }
+
+    if (weight < 0)
+    {
+        negativeEdgeWeights = true;
+    }
+}
+
+unsigned long long Graph::getVersion() const
+{
+    return version;
 }
 
 int Graph::getCurrentEdgeCount() const
@@ -96,101 +367,378 @@ void Graph::setCurrentEdgeCount(int edgeCount)
     emit currentEdgeCountValueChanged(edgeCount);
 }
 
-std::string Graph::calculateShortestPath(int source, int destination, GraphWidget* widget) const
+int Graph::getMaximumEdgeWeight() const
+{
+    return maximumEdgeWeight;
+}
+
+bool Graph::hasNegativeEdgeWeights() const
+{
+    return negativeEdgeWeights;
+}
+
+Graph::PriorityQueueType Graph::getPriorityQueueType() const
+{
+    return priorityQueueType;
+}
+
+void Graph::setPriorityQueueType(PriorityQueueType type)
+{
+    priorityQueueType = type;
+}
+
+ShortestPathResult Graph::calculateShortestPath(int source, int destination, GraphWidget* widget) const
+{
+    ShortestPathResult result;
+    calculateShortestPath(source, destination, workspace, result, widget);
+    return result;
+}
+
+void Graph::calculateShortestPath(int source, int destination, ShortestPathWorkspace& workspace, ShortestPathResult& result, GraphWidget* widget) const
+{
+    // Stop as soon as the destination's shortest path is known
+    search(source, &destination, 1, workspace, widget);
+
+    result.cost = workspace.getCost(toInternalNode(destination));
+    result.reachable = result.cost != INT_MAX;
+    getPathNodes(destination, workspace, result.nodes);
+}
+
+void Graph::calculateShortestPath(int source, int destination, ShortestPathEngine& engine, ShortestPathResult& result) const
+{
+    result.cost = engine.findShortestPath(source, destination, result.nodes);
+    result.reachable = result.cost != INT_MAX;
+}
+
+int Graph::calculateShortestPathCost(int source, int destination, ShortestPathWorkspace& workspace) const
+{
+    search(source, &destination, 1, workspace, nullptr);
+
+    return workspace.getCost(toInternalNode(destination));
+}
+
+void Graph::getPathNodes(int destination, const ShortestPathWorkspace& workspace, std::vector<int>& nodes) const
 {
-    // An array to hold the cost of the paths to a node with index i
-    int costs[nodeCount];
+    nodes.clear();
+    int node = toInternalNode(destination);
+    if (workspace.getCost(node) == INT_MAX)
+    {
+        return;
+    }
+
+    for (; node != -1; node = workspace.getPrevious(node))
+    {
+        nodes.push_back(toOriginalNode(node));
+    }
+
+    std::reverse(nodes.begin(), nodes.end());
+}
 
-    // An array to hold the path to a node throught a prevous node with the minimum value
-    int path[nodeCount];
+void Graph::calculateShortestPathTree(int source, std::vector<int>& costs, std::vector<int>& path) const
+{
+    if(!doesNodeExist(source))
+    {
+        throw DijkstraInputException("Source does not exist in the graph.");
+    }
 
-    MinHeap heap = MinHeap(nodeCount);
+    // Without targets the search settles all reachable nodes
+    search(source, nullptr, 0, workspace, nullptr);
 
+    costs.resize(nodeCount);
+    path.resize(nodeCount);
     for(int i = 0; i < nodeCount; ++i)
     {
-        costs[i] = INT_MAX;
-        path[i] = -1;
-        heap.nodes[i] = new HeapNode(i, costs[i]);
-        heap.setPosition(i, i);
+        costs[i] = workspace.getCost(toInternalNode(i));
+        path[i] = toOriginalNode(workspace.getPrevious(toInternalNode(i)));
+    }
+}
+
+void Graph::distanceMatrix(const std::vector<int>& sources, const std::vector<int>& targets, std::vector<int>& costs,
+                           std::vector<std::vector<int>>* paths) const
+{
+    for(int node : sources)
+    {
+        if(!doesNodeExist(node))
+        {
+            throw DijkstraInputException("Source does not exist in the graph.");
+        }
     }
 
-    // Change the cost of the source to be 0 because it is the first node that is visited
-    heap.nodes[source] = new HeapNode(source, costs[source]);
-    costs[source] = 0;
-    heap.decreaseCost(source, costs[source]);
+    for(int node : targets)
+    {
+        if(!doesNodeExist(node))
+        {
+            throw DijkstraInputException("Target does not exist in the graph.");
+        }
+    }
+
+    size_t targetCount = targets.size();
+    costs.resize(sources.size() * targetCount);
+    if(paths)
+    {
+        paths->resize(sources.size());
+    }
 
-    // Traverse the Heap until all nodes' shortest paths are calculated
+    for(size_t i = 0; i < sources.size(); ++i)
+    {
+        search(sources[i], targets.data(), static_cast<int>(targetCount), workspace, nullptr);
+
+        for(size_t j = 0; j < targetCount; ++j)
+        {
+            costs[i * targetCount + j] = workspace.getCost(toInternalNode(targets[j]));
+        }
+
+        if(paths)
+        {
+            std::vector<int>& path = (*paths)[i];
+            path.resize(nodeCount);
+            for(int node = 0; node < nodeCount; ++node)
+            {
+                path[node] = toOriginalNode(workspace.getPrevious(toInternalNode(node)));
+            }
+        }
+    }
+}
+
+void Graph::search(int source, const int* targets, int targetCount, ShortestPathWorkspace& workspace, GraphWidget* widget) const
+{
+    // Forget the previous query, this only costs as much as the previous query touched
+    workspace.prepare(nodeCount);
+
+    // Repeated targets are only counted once, as a node is only settled once
+    int remainingTargets = 0;
+    for(int i = 0; i < targetCount; ++i)
+    {
+        if(workspace.markTarget(toInternalNode(targets[i])))
+        {
+            remainingTargets++;
+        }
+    }
+
+    // The search runs on the nodes' new ids, the callers translate the workspace's contents back
+    source = toInternalNode(source);
+
+    PriorityQueueType type = priorityQueueType;
+
+    // Monotone integer queues rely on costs never decreasing below the last extracted one, so negative weights need the heap
+    if(type == PriorityQueueType::Automatic || negativeEdgeWeights)
+    {
+        if(negativeEdgeWeights)
+        {
+            type = PriorityQueueType::Heap;
+        }
+        else if(maximumEdgeWeight <= DIAL_MAXIMUM_EDGE_WEIGHT)
+        {
+            type = PriorityQueueType::Buckets;
+        }
+        else
+        {
+            type = PriorityQueueType::Radix;
+        }
+    }
+
+    if(type == PriorityQueueType::Buckets)
+    {
+        searchWithMonotoneQueue(workspace.getBucketQueue(maximumEdgeWeight), source, remainingTargets, workspace, widget);
+    }
+    else if(type == PriorityQueueType::Radix)
+    {
+        searchWithMonotoneQueue(workspace.getRadixHeap(), source, remainingTargets, workspace, widget);
+    }
+    else
+    {
+        searchWithHeap(source, remainingTargets, workspace, widget);
+    }
+}
+
+void Graph::searchWithHeap(int source, int remainingTargets, ShortestPathWorkspace& workspace, GraphWidget* widget) const
+{
+    // The Min-Heap holds only the reached nodes, which are not settled yet
+    IndexedDaryHeap<int, 4>& heap = workspace.getHeap();
+
+    // A compressed adjacency is decoded node by node instead of being decompressed
+    const CsrGraph* adjacency = compressedAdjacency ? nullptr : &freezeOrdered();
+
+    // The cost of the source is 0 because it is the first node that is visited
+    workspace.setCost(source, 0, -1);
+    heap.insert(source, 0);
+
+    // Traverse the Heap until all reachable nodes' shortest paths are calculated
     while(!heap.isEmpty())
     {
         // Get the minimum cost node's value
-        int minimumNodeValue = heap.getMinimumNode()->getValue();
+        int minimumNodeValue = heap.extractMinimum();
+
+        // A target's cost can not decrease anymore once it is extracted, so stop after the last one
+        if(workspace.isTarget(minimumNodeValue) && --remainingTargets == 0)
+        {
+            break;
+        }
+
+        int minimumNodeCost = workspace.getCost(minimumNodeValue);
+        const int* targets;
+        const int* weights;
+        int edgeCount = loadEdges(adjacency, minimumNodeValue, workspace, targets, weights);
+
+        // With non-negative weights an extracted node's cost can not decrease anymore,
+        // so the whole adjacency run is relaxed at once and only the nodes, whose cost decreased, are handled one by one
+        if(!negativeEdgeWeights)
+        {
+            int relaxedCount = workspace.relaxEdges(targets, weights, edgeCount, minimumNodeValue, minimumNodeCost);
+            for(int i = 0; i < relaxedCount; ++i)
+            {
+                int value = workspace.getRelaxedNode(i);
+                if(heap.doesNodeExist(value))
+                {
+                    heap.decreaseCost(value, workspace.getCost(value));
+                }
+                else
+                {
+                    heap.insert(value, workspace.getCost(value));
+                }
+
+                if(widget && toOriginalNode(minimumNodeValue))
+                {
+                    widget->scheduleTimerForDrawingPath(toOriginalNode(minimumNodeValue), toOriginalNode(value));
+                }
+            }
+
+            continue;
+        }
 
         // Traverse all adjacent nodes of the minimum one and update their costs
-        Node* adjacent = head[minimumNodeValue];
-        while(adjacent != nullptr)
+        for(int edge = 0; edge < edgeCount; ++edge)
         {
-            int value = adjacent->getValue();
+            int value = targets[edge];
+            int newCost = weights[edge] + minimumNodeCost;
 
             // Check if the cost of the node with the extracted value is calculated and if not =>
             // the cost to this node throught the minimum node is less than the prevoiusly calculated cost
-            if(heap.doesNodeExist(value) && costs[minimumNodeValue] != INT_MAX && adjacent->getCost() + costs[minimumNodeValue] < costs[value])
+            if(!heap.wasExtracted(value) && newCost < workspace.getCost(value))
             {
-                costs[value] = adjacent->getCost() + costs[minimumNodeValue];
-                // store the path throught the node with the minimum value
-                path[value] = minimumNodeValue;
-                // Update the cost value of the node in the Heap
-                heap.decreaseCost(value, costs[value]);
+                // Store the cost and the path throught the node with the minimum value
+                workspace.setCost(value, newCost, minimumNodeValue);
+                // Insert the node in the Heap or update its cost value
+                if(heap.doesNodeExist(value))
+                {
+                    heap.decreaseCost(value, newCost);
+                }
+                else
+                {
+                    heap.insert(value, newCost);
+                }
 
                 // Highlight the shortest path form the source to currently visited node in the Min-Heap if the path exists
-                if(adjacent && minimumNodeValue)
+                if(widget && toOriginalNode(minimumNodeValue))
                 {
-                    widget->scheduleTimerForDrawingPath(minimumNodeValue, value);
+                    widget->scheduleTimerForDrawingPath(toOriginalNode(minimumNodeValue), toOriginalNode(value));
                 }
             }
-
-            adjacent = adjacent->getNextNode();
         }
     }
+}
+
+template<typename Queue>
+void Graph::searchWithMonotoneQueue(Queue& queue, int source, int remainingTargets, ShortestPathWorkspace& workspace, GraphWidget* widget) const
+{
+    const CsrGraph* adjacency = compressedAdjacency ? nullptr : &freezeOrdered();
+
+    workspace.setCost(source, 0, -1);
+    queue.insert(source, 0);
+
+    while(!queue.isEmpty())
+    {
+        int minimumNodeValue = queue.extractMinimum();
+        int minimumNodeCost = queue.getLastExtractedCost();
+
+        // A node is inserted again whenever its cost decreases, so skip the entries with an outdated cost.
+        // With non-negative weights a settled node's cost never decreases again, so it is processed once.
+        if(minimumNodeCost != workspace.getCost(minimumNodeValue))
+        {
+            continue;
+        }
+
+        if(workspace.isTarget(minimumNodeValue) && --remainingTargets == 0)
+        {
+            break;
+        }
+
+        const int* targets;
+        const int* weights;
+        int edgeCount = loadEdges(adjacency, minimumNodeValue, workspace, targets, weights);
+        int relaxedCount = workspace.relaxEdges(targets, weights, edgeCount, minimumNodeValue, minimumNodeCost);
+        for(int i = 0; i < relaxedCount; ++i)
+        {
+            int value = workspace.getRelaxedNode(i);
+            queue.insert(value, workspace.getCost(value));
 
-    std::string pathMessage = "";
+            if(widget && toOriginalNode(minimumNodeValue))
+            {
+                widget->scheduleTimerForDrawingPath(toOriginalNode(minimumNodeValue), toOriginalNode(value));
+            }
+        }
+    }
+}
 
-    // Check if there is a path to the specified destination
-    if(path[destination] != -1)
+int Graph::loadEdges(const CsrGraph* adjacency, int node, ShortestPathWorkspace& workspace, const int*& targets, const int*& weights) const
+{
+    if (adjacency == nullptr)
     {
-        std::string steps = composePathToDestination(source, destination, path);
-        pathMessage = "Shortest path form " + std::to_string(source) + " to " + std::to_string(destination) + " is " + steps + " and its cost is " + std::to_string(costs[destination]);
+        return workspace.decodeEdges(*compressedAdjacency, node, targets, weights);
     }
-    else
+
+    int edgeBegin = adjacency->getEdgeBegin(node);
+    targets = adjacency->getTargets() + edgeBegin;
+    weights = adjacency->getWeights() + edgeBegin;
+    return adjacency->getEdgeEnd(node) - edgeBegin;
+}
+
+const CsrGraph& Graph::freeze() const
+{
+    if (isCsrOutdated)
     {
-        pathMessage = "There is no path form " + std::to_string(source) + " to " + std::to_string(destination);
+        csr = compressedAdjacency ? decompressAdjacency() : CsrGraph(nodeCount, head);
+        isCsrOutdated = false;
     }
 
-    return pathMessage;
+    return csr;
 }
 
-std::string Graph::composePathToDestination(int source, int destination, int* path) const
+const CsrGraph& Graph::freezeReverse() const
 {
-    // String that will be used as a final path representation
-    std::string steps = "";
+    if (isReverseCsrOutdated)
+    {
+        //A mapped file or a compressed adjacency has no incoming lists, so the adjacency is reversed instead.
+        reverseCsr = reverseHead == nullptr ? freeze().transpose() : CsrGraph(nodeCount, reverseHead);
+        isReverseCsrOutdated = false;
+    }
 
-    // Add destination to the final path
-    steps += std::to_string(destination) + "-";
+    return reverseCsr;
+}
 
-    // Get the nodes throught which the source can be accessed and add them to the final path
-    int pathDestination = path[destination];
-    steps += std::to_string(pathDestination) + "-";
-    while(pathDestination != source)
+const CsrGraph& Graph::freezeOrdered() const
+{
+    if (nodeRanks.empty())
     {
-        pathDestination = path[pathDestination];
-        steps += std::to_string(pathDestination) + "-";
+        return freeze();
     }
 
-    // Remove the last '-' from the path
-    steps.pop_back();
-    // Reverse the path so it can be readable
-    std::reverse(steps.begin(), steps.end());
+    if (isOrderedCsrOutdated)
+    {
+        orderedCsr = NodeOrdering::permute(freeze(), nodeRanks);
+        isOrderedCsrOutdated = false;
+    }
 
-    return steps;
+    return orderedCsr;
+}
+
+void Graph::prepareQueries() const
+{
+    //A compressed adjacency is decoded by every query itself.
+    if (!compressedAdjacency)
+    {
+        freezeOrdered();
+    }
 }
 
 int Graph::getCurrentNodeCount() const
@@ -200,10 +748,7 @@ int Graph::getCurrentNodeCount() const
 
 Graph::~Graph()
 {
-    for (int i = 0; i < nodeCount; i++)
-    {
-        delete[] head[i];
-    }
-
+    //The lists' nodes belong to the node arena, which frees them with its chunks.
     delete[] head;
+    delete[] reverseHead;
 };
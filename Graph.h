@@ -2,9 +2,20 @@
 #define GRAPH_H
 #include "Node.h"
 #include "Edge.h"
+#include "NodeArena.h"
+#include "EdgeIndex.h"
+#include "CsrGraph.h"
+#include "CompressedCsrGraph.h"
+#include "NodeOrdering.h"
+#include "ShortestPathWorkspace.h"
+#include "ShortestPathEngine.h"
+#include "ShortestPathResult.h"
 #include "qobject.h"
+#include <memory>
+#include <vector>
 
 class GraphWidget;
+class GraphFile;
 
 /*!
  *  Represents a graph.
@@ -16,8 +27,27 @@ class Graph : public QObject
 public:
     /*!
      * Represents the head node of an adjacency list, containing the graph.
+     * The nodes of all lists are owned by the graph's node arena.
     */
     Node** head;
+    /*!
+     * Represents the head node of an adjacency list of incoming edges for every node.
+     * The value of a node in these lists is the source of the incoming edge.
+    */
+    Node** reverseHead;
+
+    /*!
+     * Represents the priority queues, which can be used by the shortest path calculation.
+     * Automatic picks Dial's buckets for small integer weights, the radix heap for larger ones
+     * and the d-ary heap if the graph contains negative weights.
+     */
+    enum class PriorityQueueType
+    {
+        Automatic,
+        Heap,
+        Buckets,
+        Radix
+    };
 
     /*!
      * Constructor, creates a graph with the specified node count and edge count.
@@ -26,15 +56,38 @@ public:
      */
     Graph(int nodeCount, int edgeCount);
     /*!
-     * Destructor, deallocates memory.
+     * Constructor, creates a graph with the edges of a mapped graph file, which are queried in place without being copied.
+     * The edges are copied into adjacency lists and the file is released the first time the graph is changed.
+     * The file's edges are trusted, GraphFile::verify checks them for files from untrusted sources.
+     * \param file The graph file.
+     */
+    Graph(std::unique_ptr<GraphFile> file);
+    /*!
+     * Destructor, deallocates memory, the adjacency lists' nodes are freed chunk by chunk.
      */
     ~Graph();
 
     /*!
      * Adds a graph edge.
-     * \param edge The edge to be added.
+     * \param edge The edge to be added, which is copied.
      */
-    void addEdge(Edge* edge);
+    void addEdge(const Edge& edge);
+    /*!
+     * Adds a batch of graph edges, reserving their storage up front and emitting the edge count's change once.
+     * The batch is checked like single edges before any of it is added, so an invalid edge leaves the graph unchanged.
+     * \param edges The edges to be added, which are copied.
+     * \param edgeCount The count of the edges.
+     * \param isTrusted Whether the checks are skipped for pre-validated edges. Trusted edges must lie within the graph,
+     * must not be self loops and must neither repeat each other nor existing edges, the shortest path search relies on distinct edges.
+     */
+    void addEdges(const Edge* edges, int edgeCount, bool isTrusted = false);
+    /*!
+     * Changes the weight of an existing edge, the topology of the graph stays the same.
+     * \param source The edge's source.
+     * \param destination The edge's destination.
+     * \param weight The edge's new weight.
+     */
+    void setEdgeWeight(int source, int destination, int weight);
 
     /*!
      * Gets the current edge count.
@@ -48,13 +101,77 @@ public:
     void setCurrentEdgeCount(int edgeCount);
 
     /*!
-     * Caculates the shortest path between source and destintion nodes using the Dijkstra’s shortest path algorithm and returns information about the path to the specified source
+     * Caculates the shortest path between source and destintion nodes using the Dijkstra’s shortest path algorithm.
+     * The search stops as soon as the destination is settled.
+     * \param source The source node
+     * \param destination The destination node
+     * \param widget GraphWidget object used to draw the path, may be null
+     * \return The shortest path
+     */
+    ShortestPathResult calculateShortestPath(int source, int destination, GraphWidget* widget = nullptr) const;
+    /*!
+     * Caculates the shortest path between source and destintion nodes like calculateShortestPath, using the memory of the specified workspace and result.
+     * \param source The source node
+     * \param destination The destination node
+     * \param workspace The workspace, which holds the costs and the paths of the query afterwards
+     * \param result Filled with the shortest path, its node buffer is reused
+     * \param widget GraphWidget object used to draw the path, may be null
+     */
+    void calculateShortestPath(int source, int destination, ShortestPathWorkspace& workspace, ShortestPathResult& result, GraphWidget* widget = nullptr) const;
+    /*!
+     * Caculates the shortest path between source and destintion nodes with the specified engine.
+     * \param source The source node
+     * \param destination The destination node
+     * \param engine The engine, which was built for this graph
+     * \param result Filled with the shortest path, its node buffer is reused
+     */
+    void calculateShortestPath(int source, int destination, ShortestPathEngine& engine, ShortestPathResult& result) const;
+    /*!
+     * Calculates the cost of the shortest path between source and destination nodes without drawing it or composing a message.
+     * Several threads may call it at the same time with their own workspaces, once prepareQueries has been called after the last change of the graph.
      * \param source The source node
      * \param destination The destination node
-     * \param widget GraphWidget object used to draw the path
-     * \return string Representing the shortest path information
+     * \param workspace The workspace, which holds the costs and the paths of the query afterwards
+     * \return The cost of the shortest path, INT_MAX if there is no path
      */
-    std::string calculateShortestPath(int source, int destination, GraphWidget* widget) const;
+    int calculateShortestPathCost(int source, int destination, ShortestPathWorkspace& workspace) const;
+    /*!
+     * Gets the nodes of the shortest path to the destination, which the last query with the workspace found.
+     * The workspace stores the nodes by their ids in the graph's order, so its paths are read through this method.
+     * \param destination The destination node
+     * \param workspace The workspace of the last query
+     * \param nodes Filled with the nodes of the path from the source to the destination, empty if there is no path
+     */
+    void getPathNodes(int destination, const ShortestPathWorkspace& workspace, std::vector<int>& nodes) const;
+    /*!
+     * Builds the snapshots, which the shortest path queries read, so several threads can query the graph at the same time.
+     */
+    void prepareQueries() const;
+    /*!
+     * Calculates the shortest paths from the source to all nodes (the shortest path tree).
+     * Unlike calculateShortestPath, the search does not stop at a destination.
+     * \param source The source node
+     * \param costs Filled with the cost of the shortest path to every node, INT_MAX for unreachable nodes
+     * \param path Filled with the previous node on the shortest path to every node, -1 for the source and unreachable nodes
+     */
+    void calculateShortestPathTree(int source, std::vector<int>& costs, std::vector<int>& path) const;
+    /*!
+     * Calculates the costs of the shortest paths from every source to every target.
+     * Each source is searched once, until all targets are settled.
+     * \param sources The source nodes
+     * \param targets The target nodes
+     * \param costs Filled with the costs row after row, the cost from sources[i] to targets[j] at i * targets.size() + j, INT_MAX if there is no path
+     * \param paths If not null, filled with the previous node on the path to every node for every source, -1 for the sources and unreached nodes.
+     * The paths to the targets are the shortest ones, the paths to other nodes may be longer, as the search stops early.
+     */
+    void distanceMatrix(const std::vector<int>& sources, const std::vector<int>& targets, std::vector<int>& costs,
+                        std::vector<std::vector<int>>* paths = nullptr) const;
+
+    /*!
+     * Gets the graph's version, which changes whenever an edge is added or reweighted, so cached results can be checked.
+     * \return The version.
+     */
+    unsigned long long getVersion() const;
 
     /*!
      * Get the current node count
@@ -69,6 +186,66 @@ public:
      */
     bool doesNodeExist(int value) const;
 
+    /*!
+     * Gets the maximum weight of an edge added to the graph.
+     * \return The maximum edge weight, 0 if there are no edges.
+     */
+    int getMaximumEdgeWeight() const;
+    /*!
+     * Returns whether an edge with a negative weight has been added to the graph.
+     * \return Whether there are negative edge weights.
+     */
+    bool hasNegativeEdgeWeights() const;
+
+    /*!
+     * Gets the priority queue used by the shortest path calculation.
+     * \return The priority queue type.
+     */
+    PriorityQueueType getPriorityQueueType() const;
+    /*!
+     * Sets the priority queue used by the shortest path calculation.
+     * Monotone queues are replaced by the heap if the graph contains negative weights.
+     * \param type The priority queue type.
+     */
+    void setPriorityQueueType(PriorityQueueType type);
+
+    /*!
+     * Returns a contiguous snapshot of the graph's adjacency, which is used for iterating over the edges.
+     * The snapshot is rebuilt only if edges have been added since the last call.
+     * \return The adjacency snapshot.
+     */
+    const CsrGraph& freeze() const;
+    /*!
+     * Returns a contiguous snapshot of the graph's incoming edges, which is used for searching backwards.
+     * The target of an edge in this snapshot is the source of the incoming edge.
+     * \return The reverse adjacency snapshot.
+     */
+    const CsrGraph& freezeReverse() const;
+
+    /*!
+     * Replaces the adjacency lists with a compressed adjacency, which the shortest path queries decode on the fly.
+     * The snapshots are decompressed on demand for the other algorithms and the visualization, and the lists are rebuilt
+     * the first time the graph is changed.
+     */
+    void compressAdjacency();
+    /*!
+     * Returns whether the adjacency is compressed.
+     * \return Whether the adjacency is compressed.
+     */
+    bool isAdjacencyCompressed() const;
+
+    /*!
+     * Renumbers the nodes internally, so the shortest path search accesses the memory of nodes close to each other in the graph together.
+     * The graph keeps the permutation and every method still takes and returns the original ids, including the snapshots.
+     * \param type The order, Original restores the original ids.
+     */
+    void reorderNodes(NodeOrdering::Type type);
+    /*!
+     * Returns whether the nodes have been renumbered.
+     * \return Whether the nodes have been renumbered.
+     */
+    bool isReordered() const;
+
 signals:
     /*!
      * Signal, which is emitted when the current edge count's value is changed.
@@ -80,6 +257,52 @@ private:
     int nodeCount;
     int allEdgeCount;
     int currentEdgeCount;
+    unsigned long long version;
+
+    NodeArena nodeArena;
+    EdgeIndex edgeIndex;
+    /*!
+     * The mapped graph file, whose adjacency the snapshot views, until the graph is changed.
+     */
+    std::unique_ptr<GraphFile> mappedFile;
+    /*!
+     * The compressed adjacency, which replaces the adjacency lists until the graph is changed.
+     */
+    std::unique_ptr<CompressedCsrGraph> compressedAdjacency;
+
+    mutable CsrGraph csr;
+    mutable bool isCsrOutdated;
+    mutable CsrGraph reverseCsr;
+    mutable bool isReverseCsrOutdated;
+    /*!
+     * The snapshot with the nodes renumbered, which the queries search.
+     */
+    mutable CsrGraph orderedCsr;
+    mutable bool isOrderedCsrOutdated;
+
+    /*!
+     * The new id of every node and the original id of every new one, both empty if the nodes have not been renumbered.
+     */
+    std::vector<int> nodeRanks;
+    std::vector<int> rankedNodes;
+
+    /*!
+     * The workspace of the queries, which do not get one from the caller.
+     */
+    mutable ShortestPathWorkspace workspace;
+
+    /*!
+     * The maximum edge weight, up to which Dial's buckets are preferred over the radix heap.
+     */
+    static const int DIAL_MAXIMUM_EDGE_WEIGHT = 255;
+    /*!
+     * The maximum count of announced edges, which the edge index is reserved for up front.
+     */
+    static constexpr long long MAXIMUM_RESERVED_EDGE_COUNT = 1 << 22;
+
+    int maximumEdgeWeight;
+    bool negativeEdgeWeights;
+    PriorityQueueType priorityQueueType;
 
     /*!
      * Checks if an edge already exists in the graph.
@@ -88,15 +311,92 @@ private:
      * \return Whether the edge exists in the graph.
      */
     bool doesEdgeExist(int source, int destinaion) const;
+    /*!
+     * Checks whether an edge's ends lie within the graph and differ, throws DijkstraInputException otherwise.
+     * \param edge The edge.
+     */
+    void validateEdge(const Edge& edge) const;
+    /*!
+     * Links an edge, which has been checked and indexed, into the adjacency lists and updates the weights' range.
+     * \param edge The edge.
+     */
+    void linkEdge(const Edge& edge);
+    /*!
+     * Copies the edges of the mapped graph file or the compressed adjacency into adjacency lists and releases them,
+     * if the graph has no lists.
+     */
+    void restoreAdjacencyLists();
+    /*!
+     * Decompresses the compressed adjacency.
+     * \return The adjacency with the original ids.
+     */
+    CsrGraph decompressAdjacency() const;
+    /*!
+     * Returns the snapshot, which the queries search, with the nodes renumbered if they have been.
+     * \return The snapshot.
+     */
+    const CsrGraph& freezeOrdered() const;
+    /*!
+     * Translates an original id to the id, which the queries use.
+     * \param node The original id.
+     * \return The new id.
+     */
+    int toInternalNode(int node) const;
+    /*!
+     * Translates an id, which the queries use, to the original one.
+     * \param node The new id, -1 is kept.
+     * \return The original id.
+     */
+    int toOriginalNode(int node) const;
+    /*!
+     * Gets the edges leaving a node, decoding them into the workspace if the adjacency is compressed.
+     * \param adjacency The adjacency snapshot, null if the adjacency is compressed.
+     * \param node The node.
+     * \param workspace The workspace, which holds the decoded edges until the next call.
+     * \param targets Set to the destinations of the edges.
+     * \param weights Set to the weights of the edges.
+     * \return The count of edges.
+     */
+    int loadEdges(const CsrGraph* adjacency, int node, ShortestPathWorkspace& workspace, const int*& targets, const int*& weights) const;
 
     /*!
-     * Returns a formatted path from source to destination using stored steps in path array
+     * Calculates the costs of the shortest paths from the source using the configured priority queue.
      * \param source The source node
-     * \param destination The destination node
-     * \param path Pointer to an array of paths to a nodes throught a prevous node with the minimum value
-     * \return string The formatted path from source to destination
+     * \param targets The nodes, after all of which are settled the search stops, null to settle all reachable nodes
+     * \param targetCount The count of targets
+     * \param workspace The workspace, which holds the costs and the paths afterwards
+     * \param widget GraphWidget object used to draw the path, may be null
      */
-    std::string composePathToDestination(int source, int destination, int* path) const;
+    void search(int source, const int* targets, int targetCount, ShortestPathWorkspace& workspace, GraphWidget* widget) const;
+    /*!
+     * Calculates the costs of the shortest paths from the source using the indexed d-ary heap.
+     * \param source The source node
+     * \param remainingTargets The count of distinct targets marked in the workspace, the search stops when it reaches 0
+     * \param workspace The workspace, which holds the costs and the paths afterwards
+     * \param widget GraphWidget object used to draw the path, may be null
+     */
+    void searchWithHeap(int source, int remainingTargets, ShortestPathWorkspace& workspace, GraphWidget* widget) const;
+    /*!
+     * Calculates the costs of the shortest paths from the source using a monotone integer queue.
+     * Requires non-negative edge weights.
+     * \param queue The empty queue (DialBucketQueue or RadixHeap)
+     * \param source The source node
+     * \param remainingTargets The count of distinct targets marked in the workspace, the search stops when it reaches 0
+     * \param workspace The workspace, which holds the costs and the paths afterwards
+     * \param widget GraphWidget object used to draw the path, may be null
+     */
+    template<typename Queue>
+    void searchWithMonotoneQueue(Queue& queue, int source, int remainingTargets, ShortestPathWorkspace& workspace, GraphWidget* widget) const;
 };
 
+inline int Graph::toInternalNode(int node) const
+{
+    return nodeRanks.empty() ? node : nodeRanks[node];
+}
+
+inline int Graph::toOriginalNode(int node) const
+{
+    return nodeRanks.empty() || node == -1 ? node : rankedNodes[node];
+}
+
 #endif // GRAPH_H
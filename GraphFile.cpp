@@ -0,0 +1,205 @@
+#include "GraphFile.h"
+#include "Graph.h"
+#include "DijkstraException.h"
+#include <algorithm>
+#include <vector>
+
+const char* const GraphFile::FILE_EXTENSION = ".dgraph";
+
+static_assert(sizeof(int) == 4 && sizeof(long long) == 8, "The binary graph format needs 32 bit integers and 64 bit positions.");
+
+GraphFile::GraphFile(const QString& fileName)
+    : file(fileName)
+{
+    this->data = nullptr;
+    this->maximumEdgeWeight = 0;
+    this->negativeEdgeWeights = false;
+    this->checksum = 0;
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        throw DijkstraException("Could not open graph file.");
+    }
+
+    long long fileSize = file.size();
+    if (fileSize < static_cast<long long>(sizeof(FileHeader)))
+    {
+        throw DijkstraException("File is not a compatible graph file.");
+    }
+
+    data = file.map(0, fileSize);
+    if (data == nullptr)
+    {
+        throw DijkstraException("Could not map graph file.");
+    }
+
+    const FileHeader* header = reinterpret_cast<const FileHeader*>(data);
+    if (header->magic != FILE_MAGIC || header->version != FILE_VERSION || header->nodeCount < 0 || header->edgeCount < 0)
+    {
+        throw DijkstraException("File is not a compatible graph file.");
+    }
+
+    // Every section has to be aligned and lie within the file, the mapping starts at a page, so aligned positions are aligned addresses
+    long long positions[] = { header->offsetsPosition, header->targetsPosition, header->weightsPosition };
+    long long counts[] = { header->nodeCount + 1LL, header->edgeCount, header->edgeCount };
+    for (int i = 0; i < 3; i++)
+    {
+        if (positions[i] < static_cast<long long>(sizeof(FileHeader)) || positions[i] % SECTION_ALIGNMENT != 0
+            || positions[i] > fileSize || counts[i] > (fileSize - positions[i]) / static_cast<long long>(sizeof(int)))
+        {
+            throw DijkstraException("Graph file is truncated.");
+        }
+    }
+
+    const int* offsets = reinterpret_cast<const int*>(data + header->offsetsPosition);
+    if (offsets[0] != 0 || offsets[header->nodeCount] != header->edgeCount)
+    {
+        throw DijkstraException("Graph file is corrupted.");
+    }
+
+    adjacency = CsrGraph(header->nodeCount, offsets,
+                         reinterpret_cast<const int*>(data + header->targetsPosition),
+                         reinterpret_cast<const int*>(data + header->weightsPosition));
+    maximumEdgeWeight = header->maximumEdgeWeight;
+    negativeEdgeWeights = (header->flags & NEGATIVE_EDGE_WEIGHTS_FLAG) != 0;
+    checksum = header->checksum;
+}
+
+GraphFile::~GraphFile()
+{
+    if (data != nullptr)
+    {
+        file.unmap(data);
+    }
+}
+
+void GraphFile::save(const Graph& graph, const QString& fileName)
+{
+    const CsrGraph& adjacency = graph.freeze();
+
+    FileHeader header = {};
+    header.magic = FILE_MAGIC;
+    header.version = FILE_VERSION;
+    header.nodeCount = adjacency.getNodeCount();
+    header.edgeCount = adjacency.getEdgeCount();
+    header.maximumEdgeWeight = graph.getMaximumEdgeWeight();
+    header.flags = graph.hasNegativeEdgeWeights() ? NEGATIVE_EDGE_WEIGHTS_FLAG : 0;
+    header.offsetsPosition = alignPosition(sizeof(FileHeader));
+    header.targetsPosition = alignPosition(header.offsetsPosition + (header.nodeCount + 1LL) * sizeof(int));
+    header.weightsPosition = alignPosition(header.targetsPosition + header.edgeCount * static_cast<long long>(sizeof(int)));
+    header.checksum = calculateChecksum(adjacency);
+
+    // The snapshot may view the mapped file, which is being replaced, so the file is written aside and only renamed over it when complete
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        throw DijkstraException("Could not open graph file.");
+    }
+
+    if (file.write(reinterpret_cast<const char*>(&header), sizeof(header)) != static_cast<qint64>(sizeof(header)))
+    {
+        throw DijkstraException("Could not write graph file.");
+    }
+
+    long long end = sizeof(header);
+    end = writeSection(file, end, header.offsetsPosition, adjacency.getOffsets(), header.nodeCount + 1LL);
+    end = writeSection(file, end, header.targetsPosition, adjacency.getTargets(), header.edgeCount);
+    writeSection(file, end, header.weightsPosition, adjacency.getWeights(), header.edgeCount);
+
+    if (!file.commit())
+    {
+        throw DijkstraException("Could not write graph file.");
+    }
+}
+
+void GraphFile::verify() const
+{
+    if (calculateChecksum(adjacency) != checksum)
+    {
+        throw DijkstraException("Graph file is corrupted.");
+    }
+
+    // The checksum does not protect against files written by other tools, so the edges are checked like Graph::addEdge does
+    int nodeCount = adjacency.getNodeCount();
+    int maximumWeight = 0;
+    bool hasNegativeWeight = false;
+    std::vector<int> lastSources(nodeCount, -1);
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        if (adjacency.getEdgeEnd(i) < adjacency.getEdgeBegin(i))
+        {
+            throw DijkstraException("Graph file is corrupted.");
+        }
+
+        for (int edge = adjacency.getEdgeBegin(i); edge < adjacency.getEdgeEnd(i); edge++)
+        {
+            int target = adjacency.getTarget(edge);
+            if (target < 0 || target >= nodeCount || target == i || lastSources[target] == i)
+            {
+                throw DijkstraException("Graph file contains invalid edges.");
+            }
+
+            lastSources[target] = i;
+            maximumWeight = std::max(maximumWeight, adjacency.getWeight(edge));
+            hasNegativeWeight = hasNegativeWeight || adjacency.getWeight(edge) < 0;
+        }
+    }
+
+    // The weights' range selects the priority queue, so it has to match the edges
+    if (maximumWeight != maximumEdgeWeight || hasNegativeWeight != negativeEdgeWeights)
+    {
+        throw DijkstraException("Graph file is corrupted.");
+    }
+}
+
+const CsrGraph& GraphFile::getAdjacency() const
+{
+    return adjacency;
+}
+
+int GraphFile::getMaximumEdgeWeight() const
+{
+    return maximumEdgeWeight;
+}
+
+bool GraphFile::hasNegativeEdgeWeights() const
+{
+    return negativeEdgeWeights;
+}
+
+unsigned long long GraphFile::calculateChecksum(const CsrGraph& adjacency)
+{
+    const int* sections[] = { adjacency.getOffsets(), adjacency.getTargets(), adjacency.getWeights() };
+    long long counts[] = { adjacency.getNodeCount() + 1LL, adjacency.getEdgeCount(), adjacency.getEdgeCount() };
+
+    unsigned long long hash = 0xCBF29CE484222325ULL;
+    for (int i = 0; i < 3; i++)
+    {
+        for (long long j = 0; j < counts[i]; j++)
+        {
+            hash = (hash ^ static_cast<unsigned int>(sections[i][j])) * 0x100000001B3ULL;
+        }
+    }
+
+    return hash;
+}
+
+long long GraphFile::alignPosition(long long position)
+{
+    return (position + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+}
+
+long long GraphFile::writeSection(QIODevice& file, long long end, long long position, const int* values, long long count)
+{
+    static const char padding[SECTION_ALIGNMENT] = {};
+    qint64 paddingSize = static_cast<qint64>(position - end);
+    qint64 size = static_cast<qint64>(count * sizeof(int));
+
+    if (file.write(padding, paddingSize) != paddingSize || file.write(reinterpret_cast<const char*>(values), size) != size)
+    {
+        throw DijkstraException("Could not write graph file.");
+    }
+
+    return position + size;
+}
@@ -0,0 +1,133 @@
+#ifndef GRAPHFILE_H
+#define GRAPHFILE_H
+
+#include "CsrGraph.h"
+#include <QFile>
+#include <QSaveFile>
+#include <QString>
+
+class Graph;
+
+/*!
+ * Represents a graph saved in the binary graph format, which is mapped into memory and queried in place.
+ * The file starts with a header, followed by the offsets, targets and weights of the graph's compressed sparse row form,
+ * each starting at a multiple of SECTION_ALIGNMENT. Opening a file only checks its header, so it takes constant time,
+ * the adjacency is read from the mapped pages as the queries touch them. The integers are stored in the byte order
+ * of the machine, which saved the file, a file of another byte order is rejected by its magic number.
+ */
+class GraphFile
+{
+public:
+    /*!
+     * The extension of binary graph files.
+     */
+    static const char* const FILE_EXTENSION;
+
+    /*!
+     * Constructor, maps the specified file and checks its header, throws DijkstraException if it is not a compatible graph file.
+     * \param fileName The name of the file.
+     */
+    GraphFile(const QString& fileName);
+    /*!
+     * Destructor, unmaps the file.
+     */
+    ~GraphFile();
+
+    GraphFile(const GraphFile&) = delete;
+    GraphFile& operator=(const GraphFile&) = delete;
+
+    /*!
+     * Saves a graph in the binary graph format. The file is written under a temporary name and replaces the target once it is complete,
+     * so a graph can be saved to the file, which it is mapped from.
+     * \param graph The graph.
+     * \param fileName The name of the file.
+     */
+    static void save(const Graph& graph, const QString& fileName);
+
+    /*!
+     * Checks the checksum and the adjacency of the file, which reads the whole file,
+     * throws DijkstraException if the file is corrupted or its edges would be rejected by Graph::addEdge.
+     * Opening a file only checks its header and the bounds of its sections, so only this check guarantees, that the targets lie within the graph
+     * and every node's targets are distinct, which RelaxationKernel relies on. Files written by save meet it by construction,
+     * so it can only be skipped for files from a trusted source, whose edges are then trusted like those of Graph::addEdges.
+     */
+    void verify() const;
+
+    /*!
+     * Gets the adjacency, a view of the mapped file, which is valid as long as the file.
+     * \return The adjacency.
+     */
+    const CsrGraph& getAdjacency() const;
+    /*!
+     * Gets the maximum edge weight of the graph.
+     * \return The maximum edge weight, 0 for a graph without edges.
+     */
+    int getMaximumEdgeWeight() const;
+    /*!
+     * Checks whether the graph has negative edge weights.
+     * \return Whether the graph has negative edge weights.
+     */
+    bool hasNegativeEdgeWeights() const;
+
+private:
+    /*!
+     * Represents the header at the start of a file.
+     */
+    struct FileHeader
+    {
+        int magic;
+        int version;
+        int nodeCount;
+        int edgeCount;
+        int maximumEdgeWeight;
+        int flags;
+        long long offsetsPosition;
+        long long targetsPosition;
+        long long weightsPosition;
+        unsigned long long checksum;
+        int reserved[2];
+    };
+
+    static const int FILE_MAGIC = 0x48504744;
+    static const int FILE_VERSION = 1;
+    /*!
+     * The flag of a graph with negative edge weights.
+     */
+    static const int NEGATIVE_EDGE_WEIGHTS_FLAG = 1;
+    /*!
+     * The alignment of the sections, a cache line, so every section starts at a line of its own.
+     */
+    static const int SECTION_ALIGNMENT = 64;
+
+    QFile file;
+    uchar* data;
+    CsrGraph adjacency;
+    int maximumEdgeWeight;
+    bool negativeEdgeWeights;
+    unsigned long long checksum;
+
+    /*!
+     * Calculates the checksum of an adjacency, FNV-1a over the integers of its offsets, targets and weights.
+     * \param adjacency The adjacency.
+     * \return The checksum.
+     */
+    static unsigned long long calculateChecksum(const CsrGraph& adjacency);
+    /*!
+     * Rounds a file position up to the next multiple of SECTION_ALIGNMENT.
+     * \param position The position.
+     * \return The aligned position.
+     */
+    static long long alignPosition(long long position);
+    /*!
+     * Writes a section of a file, preceded by zeros up to its position.
+     * \param file The file, positioned at the end of the previous section.
+     * \param end The position of the end of the previous section.
+     * \param position The position of the section.
+     * \param values The section's integers.
+     * \param count The count of the integers.
+     * \return The position of the end of the section.
+     */
+    static long long writeSection(QIODevice& file, long long end, long long position, const int* values, long long count);
+};
+
+#endif // GRAPHFILE_H
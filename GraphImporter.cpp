@@ -0,0 +1,385 @@
+#include "GraphImporter.h"
+#include "DijkstraException.h"
+#include <algorithm>
+#include <charconv>
+#include <climits>
+#include <cstring>
+#include <string>
+
+GraphImporter::GraphImporter(Format format)
+{
+    this->format = format;
+    this->nodeCount = 0;
+    this->droppedEdgeCount = 0;
+}
+
+void GraphImporter::setProgressCallback(std::function<bool(long long, long long)> progressCallback)
+{
+    this->progressCallback = progressCallback;
+}
+
+bool GraphImporter::importFile(QFile& file)
+{
+    qint64 size = file.size();
+    if (size == 0)
+    {
+        return import(nullptr, nullptr);
+    }
+
+    // Mapping avoids copying the text, files, which can not be mapped, are read in one piece
+    uchar* data = file.map(0, size);
+    if (data != nullptr)
+    {
+        const char* text = reinterpret_cast<const char*>(data);
+        return import(text, text + size);
+    }
+
+    std::vector<char> buffer(static_cast<size_t>(size));
+    if (file.read(buffer.data(), size) != size)
+    {
+        throw DijkstraException("Could not read graph file.");
+    }
+
+    return import(buffer.data(), buffer.data() + buffer.size());
+}
+
+bool GraphImporter::import(const char* begin, const char* end)
+{
+    nodeCount = 0;
+    edges.clear();
+    droppedEdgeCount = 0;
+
+    ImportState state = { false, 0, 0, false, -1, end };
+    long long lineNumber = 0;
+    long long nextProgressPosition = PROGRESS_BLOCK_SIZE;
+
+    const char* line = begin;
+    while (line < end)
+    {
+        lineNumber++;
+        const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', static_cast<size_t>(end - line)));
+        if (lineEnd == nullptr)
+        {
+            lineEnd = end;
+        }
+
+        const char* contentEnd = lineEnd > line && lineEnd[-1] == '\r' ? lineEnd - 1 : lineEnd;
+
+        bool isWellFormed;
+        switch (format)
+        {
+        case Format::Dimacs:
+            isWellFormed = parseDimacsLine(line, contentEnd, state);
+            break;
+        case Format::Metis:
+            isWellFormed = parseMetisLine(line, contentEnd, state);
+            break;
+        default:
+            isWellFormed = parseSnapLine(line, contentEnd, state);
+            break;
+        }
+
+        if (!isWellFormed)
+        {
+            std::string message = "File couldn't be parsed! Line " + std::to_string(lineNumber) + " is malformed.";
+            throw DijkstraException(message.c_str());
+        }
+
+        line = lineEnd == end ? end : lineEnd + 1;
+
+        if (progressCallback && line - begin >= nextProgressPosition)
+        {
+            nextProgressPosition += PROGRESS_BLOCK_SIZE;
+            if (!progressCallback(line - begin, static_cast<long long>(edges.size())))
+            {
+                edges.clear();
+                return false;
+            }
+        }
+    }
+
+    if (format == Format::Snap)
+    {
+        nodeCount = state.snapMaximumNode + 1;
+    }
+    else if (!state.hasHeader)
+    {
+        throw DijkstraException("File couldn't be parsed! The header line is missing.");
+    }
+    else if (format == Format::Metis && state.metisNode < nodeCount)
+    {
+        throw DijkstraException("File couldn't be parsed! The file has fewer node lines than nodes.");
+    }
+
+    simplifyEdges();
+    return true;
+}
+
+int GraphImporter::getNodeCount() const
+{
+    return nodeCount;
+}
+
+const std::vector<Edge>& GraphImporter::getEdges() const
+{
+    return edges;
+}
+
+long long GraphImporter::getDroppedEdgeCount() const
+{
+    return droppedEdgeCount;
+}
+
+bool GraphImporter::parseDimacsLine(const char* line, const char* end, ImportState& state)
+{
+    if (isLineEnd(line, end) || *line == 'c')
+    {
+        return true;
+    }
+
+    const char* position = line + 1;
+    if (*line == 'p')
+    {
+        // "p sp nodes arcs", the words before the counts are skipped
+        int value = 0;
+        const char* number = nullptr;
+        while (!state.hasHeader && !isLineEnd(position, end) && (number = parseNumber(position, end, value)) == nullptr)
+        {
+            position = skipToken(position, end);
+        }
+
+        if (number == nullptr || value < 0)
+        {
+            return false;
+        }
+
+        nodeCount = value;
+        state.hasHeader = true;
+        position = number;
+
+        int arcCount;
+        number = parseNumber(position, end, arcCount);
+        if (number != nullptr && arcCount > 0)
+        {
+            edges.reserve(estimateEdgeCapacity(state.textEnd - end, MINIMUM_DIMACS_ARC_SIZE, arcCount));
+            position = number;
+        }
+
+        return isLineEnd(position, end);
+    }
+
+    int values[3];
+    for (int i = 0; i < 3 && position != nullptr; i++)
+    {
+        position = parseNumber(position, end, values[i]);
+    }
+
+    if (position == nullptr || !isLineEnd(position, end) || !state.hasHeader || values[0] < 1 || values[0] > nodeCount)
+    {
+        return false;
+    }
+
+    if (*line == 'a')
+    {
+        if (values[1] < 1 || values[1] > nodeCount)
+        {
+            return false;
+        }
+
+        edges.push_back(Edge(values[0] - 1, values[1] - 1, values[2]));
+        return true;
+    }
+
+    return false;
+}
+
+bool GraphImporter::parseMetisLine(const char* line, const char* end, ImportState& state)
+{
+    if (line < end && *line == '%')
+    {
+        return true;
+    }
+
+    if (!state.hasHeader)
+    {
+        if (isLineEnd(line, end))
+        {
+            return true;
+        }
+
+        // "nodes edges [format [constraints]]", the format's digits flag vertex sizes, vertex weights and edge weights
+        int counts[4] = { 0, 0, 0, 1 };
+        const char* position = line;
+        int countCount = 0;
+        while (countCount < 4 && !isLineEnd(position, end))
+        {
+            position = parseNumber(position, end, counts[countCount++]);
+            if (position == nullptr)
+            {
+                return false;
+            }
+        }
+
+        if (countCount < 2 || !isLineEnd(position, end) || counts[0] < 0 || counts[1] < 0 || counts[3] < 0)
+        {
+            return false;
+        }
+
+        nodeCount = counts[0];
+        // Every undirected edge is listed by both of its nodes
+        edges.reserve(estimateEdgeCapacity(state.textEnd - end, MINIMUM_METIS_NEIGHBOUR_SIZE, 2LL * counts[1]));
+        state.hasHeader = true;
+        state.hasMetisWeights = counts[2] % 10 == 1;
+        state.metisSkippedValueCount = (counts[2] / 100 % 10 == 1 ? 1 : 0) + (counts[2] / 10 % 10 == 1 ? counts[3] : 0);
+        return true;
+    }
+
+    // Lines after the last node's may only be empty
+    if (state.metisNode == nodeCount)
+    {
+        return isLineEnd(line, end);
+    }
+
+    const char* position = line;
+    int value;
+    for (int i = 0; i < state.metisSkippedValueCount; i++)
+    {
+        position = parseNumber(position, end, value);
+        if (position == nullptr)
+        {
+            return false;
+        }
+    }
+
+    while (!isLineEnd(position, end))
+    {
+        int neighbour;
+        int weight = 1;
+        position = parseNumber(position, end, neighbour);
+        if (position != nullptr && state.hasMetisWeights)
+        {
+            position = parseNumber(position, end, weight);
+        }
+
+        if (position == nullptr || neighbour < 1 || neighbour > nodeCount)
+        {
+            return false;
+        }
+
+        edges.push_back(Edge(state.metisNode, neighbour - 1, weight));
+    }
+
+    state.metisNode++;
+    return true;
+}
+
+bool GraphImporter::parseSnapLine(const char* line, const char* end, ImportState& state)
+{
+    if (isLineEnd(line, end) || *line == '#')
+    {
+        return true;
+    }
+
+    int source;
+    int destination;
+    int weight = 1;
+    const char* position = parseNumber(line, end, source);
+    if (position != nullptr)
+    {
+        position = parseNumber(position, end, destination);
+    }
+
+    if (position != nullptr && !isLineEnd(position, end))
+    {
+        position = parseNumber(position, end, weight);
+    }
+
+    if (position == nullptr || !isLineEnd(position, end) || source < 0 || destination < 0 || source == INT_MAX || destination == INT_MAX)
+    {
+        return false;
+    }
+
+    state.snapMaximumNode = std::max(state.snapMaximumNode, std::max(source, destination));
+    edges.push_back(Edge(source, destination, weight));
+    return true;
+}
+
+const char* GraphImporter::parseNumber(const char* position, const char* end, int& value)
+{
+    while (position < end && (*position == ' ' || *position == '\t'))
+    {
+        position++;
+    }
+
+    std::from_chars_result result = std::from_chars(position, end, value);
+    if (result.ec != std::errc() || (result.ptr < end && *result.ptr != ' ' && *result.ptr != '\t'))
+    {
+        return nullptr;
+    }
+
+    return result.ptr;
+}
+
+const char* GraphImporter::skipToken(const char* position, const char* end)
+{
+    while (position < end && (*position == ' ' || *position == '\t'))
+    {
+        position++;
+    }
+
+    while (position < end && *position != ' ' && *position != '\t')
+    {
+        position++;
+    }
+
+    return position;
+}
+
+bool GraphImporter::isLineEnd(const char* position, const char* end)
+{
+    while (position < end && (*position == ' ' || *position == '\t'))
+    {
+        position++;
+    }
+
+    return position == end;
+}
+
+size_t GraphImporter::estimateEdgeCapacity(long long byteCount, long long minimumEdgeSize, long long announcedEdgeCount)
+{
+    // The last line may lack its line feed
+    return static_cast<size_t>(std::min(announcedEdgeCount, (byteCount + 1) / minimumEdgeSize));
+}
+
+void GraphImporter::simplifyEdges()
+{
+    size_t importedEdgeCount = edges.size();
+
+    edges.erase(std::remove_if(edges.begin(), edges.end(), [](const Edge& edge)
+    {
+        return edge.getSource() == edge.getDestination();
+    }), edges.end());
+
+    // The cheapest of parallel edges comes first, so it is the one unique keeps
+    std::sort(edges.begin(), edges.end(), [](const Edge& first, const Edge& second)
+    {
+        if (first.getSource() != second.getSource())
+        {
+            return first.getSource() < second.getSource();
+        }
+
+        if (first.getDestination() != second.getDestination())
+        {
+            return first.getDestination() < second.getDestination();
+        }
+
+        return first.getWeight() < second.getWeight();
+    });
+
+    edges.erase(std::unique(edges.begin(), edges.end(), [](const Edge& first, const Edge& second)
+    {
+        return first.getSource() == second.getSource() && first.getDestination() == second.getDestination();
+    }), edges.end());
+
+    droppedEdgeCount = static_cast<long long>(importedEdgeCount - edges.size());
+}
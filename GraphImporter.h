@@ -0,0 +1,152 @@
+#ifndef GRAPHIMPORTER_H
+#define GRAPHIMPORTER_H
+
+#include "Edge.h"
+#include <QFile>
+#include <functional>
+#include <vector>
+
+/*!
+ * Represents a streaming importer of the graph formats of public benchmark graphs.
+ * DIMACS shortest path files (.gr) list "a source destination weight" arcs with nodes numbered from 1.
+ * METIS files list the neighbours (and with format 1 the edge weights) of every node on its own line, numbered from 1,
+ * every undirected edge appears in both directions. SNAP edge lists have a "source destination" line per edge,
+ * numbered from 0, with an optional weight. Unweighted edges get the weight 1.
+ * The benchmark graphs contain self loops and parallel edges, which Graph rejects, so the importer drops self loops
+ * and keeps the cheapest of parallel edges. The imported edges can then be added to a graph as trusted ones.
+ */
+class GraphImporter
+{
+public:
+    /*!
+     * Represents the supported formats.
+     */
+    enum class Format
+    {
+        Dimacs,
+        Metis,
+        Snap
+    };
+
+    /*!
+     * Constructor, creates an importer of the specified format.
+     * \param format The format.
+     */
+    GraphImporter(Format format);
+
+    /*!
+     * Sets the callback, which receives the progress of the import.
+     * \param progressCallback Called with the count of parsed bytes and parsed edges, returns whether the import continues.
+     */
+    void setProgressCallback(std::function<bool(long long, long long)> progressCallback);
+
+    /*!
+     * Imports a file, throws DijkstraException, naming the line, if it is malformed.
+     * \param file The file, opened for reading.
+     * \return Whether the file was imported completely, false if the progress callback cancelled the import.
+     */
+    bool importFile(QFile& file);
+    /*!
+     * Imports a text, throws DijkstraException, naming the line, if it is malformed.
+     * \param begin The first character of the text.
+     * \param end The character after the text's last one.
+     * \return Whether the text was imported completely, false if the progress callback cancelled the import.
+     */
+    bool import(const char* begin, const char* end);
+
+    /*!
+     * Gets the node count.
+     * \return The node count.
+     */
+    int getNodeCount() const;
+    /*!
+     * Gets the imported edges, sorted by source and destination, without self loops and parallel edges.
+     * \return The edges.
+     */
+    const std::vector<Edge>& getEdges() const;
+    /*!
+     * Gets the count of dropped self loops and parallel edges.
+     * \return The count of dropped edges.
+     */
+    long long getDroppedEdgeCount() const;
+
+private:
+    /*!
+     * The size of the text in bytes, after which the progress is reported.
+     */
+    static const long long PROGRESS_BLOCK_SIZE = 1 << 22;
+    /*!
+     * The sizes in bytes of the shortest DIMACS arc line ("a 1 2 0" and a line feed) and of the shortest METIS neighbour,
+     * which bound the count of edges the rest of a text can hold.
+     */
+    static const long long MINIMUM_DIMACS_ARC_SIZE = 8;
+    static const long long MINIMUM_METIS_NEIGHBOUR_SIZE = 2;
+
+    Format format;
+    std::function<bool(long long, long long)> progressCallback;
+    int nodeCount;
+    std::vector<Edge> edges;
+    long long droppedEdgeCount;
+
+    /*!
+     * Represents the state of the line by line import, which the formats' line parsers share.
+     */
+    struct ImportState
+    {
+        bool hasHeader;
+        int metisNode;
+        int metisSkippedValueCount;
+        bool hasMetisWeights;
+        int snapMaximumNode;
+        const char* textEnd;
+    };
+
+    /*!
+     * Parses a line, the parsers of the formats return whether the line is well formed.
+     * \param line The first character of the line.
+     * \param end The character after the line's last one, without line feed.
+     * \param state The state of the import.
+     * \return Whether the line is well formed.
+     */
+    bool parseDimacsLine(const char* line, const char* end, ImportState& state);
+    bool parseMetisLine(const char* line, const char* end, ImportState& state);
+    bool parseSnapLine(const char* line, const char* end, ImportState& state);
+
+    /*!
+     * Parses a number, which is preceded by spaces or tabs and followed by a space, a tab or the line's end.
+     * \param position The character after the previous token.
+     * \param end The character after the line's last one.
+     * \param value Set to the number.
+     * \return The character after the number, nullptr if the next token is not a number.
+     */
+    static const char* parseNumber(const char* position, const char* end, int& value);
+    /*!
+     * Skips a token, which is preceded by spaces or tabs.
+     * \param position The character after the previous token.
+     * \param end The character after the line's last one.
+     * \return The character after the token.
+     */
+    static const char* skipToken(const char* position, const char* end);
+    /*!
+     * Checks whether only spaces or tabs are left on a line.
+     * \param position The character after the last token.
+     * \param end The character after the line's last one.
+     * \return Whether the line has ended.
+     */
+    static bool isLineEnd(const char* position, const char* end);
+    /*!
+     * Estimates the capacity for the edges a header announces, which is limited by the count of edges the rest of the text can hold,
+     * so a corrupt count does not allocate memory.
+     * \param byteCount The size of the rest of the text in bytes.
+     * \param minimumEdgeSize The size of the shortest edge of the format in bytes.
+     * \param announcedEdgeCount The count of edges announced by the header.
+     * \return The capacity.
+     */
+    static size_t estimateEdgeCapacity(long long byteCount, long long minimumEdgeSize, long long announcedEdgeCount);
+    /*!
+     * Sorts the edges, drops self loops and keeps the cheapest of parallel edges.
+     */
+    void simplifyEdges();
+};
+
+#endif // GRAPHIMPORTER_H
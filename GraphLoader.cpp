@@ -0,0 +1,181 @@
+#include "GraphLoader.h"
+#include "GraphFile.h"
+#include "TextGraphParser.h"
+#include "DijkstraException.h"
+#include <QFile>
+#include <QMetaType>
+#include <algorithm>
+#include <memory>
+
+GraphLoader::GraphLoader(const QString& fileName, FileFormat format)
+{
+    this->fileName = fileName;
+    this->format = format;
+    this->resultThread = thread();
+    this->isCancelled = false;
+    this->isBinaryFileVerified = true;
+
+    // The graph crosses threads through a queued connection, which needs its type to be registered
+    qRegisterMetaType<Graph*>("Graph*");
+}
+
+void GraphLoader::cancel()
+{
+    isCancelled = true;
+}
+
+void GraphLoader::setBinaryFileVerification(bool isEnabled)
+{
+    isBinaryFileVerified = isEnabled;
+}
+
+void GraphLoader::load()
+{
+    try
+    {
+        FileFormat fileFormat = format;
+        if (fileFormat == FileFormat::Automatic)
+        {
+            if (fileName.endsWith(GraphFile::FILE_EXTENSION))
+            {
+                fileFormat = FileFormat::Binary;
+            }
+            else if (fileName.endsWith(".gr"))
+            {
+                fileFormat = FileFormat::Dimacs;
+            }
+            else if (fileName.endsWith(".graph") || fileName.endsWith(".metis"))
+            {
+                fileFormat = FileFormat::Metis;
+            }
+            else
+            {
+                fileFormat = FileFormat::Text;
+            }
+        }
+
+        Graph* graph = nullptr;
+        switch (fileFormat)
+        {
+        case FileFormat::Binary:
+            graph = loadBinary();
+            break;
+        case FileFormat::Dimacs:
+            graph = loadImported(GraphImporter::Format::Dimacs);
+            break;
+        case FileFormat::Metis:
+            graph = loadImported(GraphImporter::Format::Metis);
+            break;
+        case FileFormat::Snap:
+            graph = loadImported(GraphImporter::Format::Snap);
+            break;
+        default:
+            graph = loadText();
+            break;
+        }
+
+        if (graph == nullptr)
+        {
+            emit cancelled();
+        }
+        else
+        {
+            // The graph was created on the worker thread, it belongs to the receiver's thread from now on
+            graph->moveToThread(resultThread);
+            emit loaded(graph);
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        emit failed(QString(ex.what()));
+    }
+
+    emit finished();
+}
+
+Graph* GraphLoader::loadText()
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        throw DijkstraException("File could not be opened in the correct mode! Are you opening a .txt file?");
+    }
+
+    qint64 totalBytes = file.size();
+    TextGraphParser parser;
+    parser.setProgressCallback([this, totalBytes](long long parsedBytes, long long)
+    {
+        emit progressChanged(parsedBytes, totalBytes, 0, 0);
+        return !isCancelled.load();
+    });
+
+    if (!parser.parseFile(file))
+    {
+        return nullptr;
+    }
+
+    return buildGraph(parser.getNodeCount(), parser.getEdgeCount(), parser.getEdges(), totalBytes, false);
+}
+
+Graph* GraphLoader::loadImported(GraphImporter::Format importFormat)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        throw DijkstraException("File could not be opened in the correct mode!");
+    }
+
+    qint64 totalBytes = file.size();
+    GraphImporter importer(importFormat);
+    importer.setProgressCallback([this, totalBytes](long long parsedBytes, long long)
+    {
+        emit progressChanged(parsedBytes, totalBytes, 0, 0);
+        return !isCancelled.load();
+    });
+
+    if (!importer.importFile(file))
+    {
+        return nullptr;
+    }
+
+    // The importer drops self loops and parallel edges, so the edges are added without checks
+    const std::vector<Edge>& edges = importer.getEdges();
+    return buildGraph(importer.getNodeCount(), static_cast<int>(edges.size()), edges, totalBytes, true);
+}
+
+Graph* GraphLoader::buildGraph(int nodeCount, int edgeCount, const std::vector<Edge>& edges, qint64 totalBytes, bool isTrusted)
+{
+    std::unique_ptr<Graph> graph(new Graph(nodeCount, edgeCount));
+    qint64 totalEdges = static_cast<qint64>(edges.size());
+
+    for (size_t i = 0; i < edges.size(); i += EDGE_BATCH_SIZE)
+    {
+        if (isCancelled)
+        {
+            return nullptr;
+        }
+
+        int batchSize = static_cast<int>(std::min(edges.size() - i, static_cast<size_t>(EDGE_BATCH_SIZE)));
+        graph->addEdges(edges.data() + i, batchSize, isTrusted);
+        emit progressChanged(totalBytes, totalBytes, static_cast<qint64>(i + batchSize), totalEdges);
+    }
+
+    return graph.release();
+}
+
+Graph* GraphLoader::loadBinary()
+{
+    // Opening only checks the header and the section bounds, the edges are only safe to query once the whole file is verified
+    std::unique_ptr<GraphFile> graphFile(new GraphFile(fileName));
+    if (isBinaryFileVerified)
+    {
+        graphFile->verify();
+    }
+
+    if (isCancelled)
+    {
+        return nullptr;
+    }
+
+    return new Graph(std::move(graphFile));
+}
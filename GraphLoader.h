@@ -0,0 +1,130 @@
+#ifndef GRAPHLOADER_H
+#define GRAPHLOADER_H
+
+#include "Graph.h"
+#include "GraphImporter.h"
+#include <QObject>
+#include <QString>
+#include <QThread>
+#include <atomic>
+
+/*!
+ * Represents the loading of a graph file on a worker thread, so the window stays responsive during large loads.
+ * The loader is moved to a worker thread, whose started signal is connected to load. The graph is built entirely on the worker thread
+ * and handed over by the loaded signal, moved to the thread, which created the loader, so the receiver can swap it in at once.
+ * Text files are parsed by TextGraphParser, binary graph files are mapped by GraphFile and benchmark graphs are imported by GraphImporter.
+ */
+class GraphLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    /*!
+     * Represents the formats of the loaded files.
+     * Automatic picks the format by the file's extension, .dgraph for binary, .gr for DIMACS, .graph or .metis for METIS and text otherwise.
+     * SNAP edge lists share the extension of text files, so they have to be specified.
+     */
+    enum class FileFormat
+    {
+        Automatic,
+        Text,
+        Binary,
+        Dimacs,
+        Metis,
+        Snap
+    };
+
+    /*!
+     * Constructor, creates a loader of the specified file.
+     * \param fileName The name of the file.
+     * \param format The format of the file.
+     */
+    GraphLoader(const QString& fileName, FileFormat format = FileFormat::Automatic);
+
+    /*!
+     * Cancels the loading, can be called from any thread. The loader emits cancelled once it notices.
+     */
+    void cancel();
+    /*!
+     * Sets whether binary graph files are verified while they are loaded, which is on by default.
+     * Opening a binary file only checks its header and section bounds, verifying it reads the whole file, see GraphFile::verify.
+     * Only callers, which load files they wrote themselves, should turn it off, an unverified file is read out of bounds if it is corrupted.
+     * \param isEnabled Whether binary graph files are verified.
+     */
+    void setBinaryFileVerification(bool isEnabled);
+
+public slots:
+    /*!
+     * Slot, loads the graph and emits exactly one of loaded, failed and cancelled, followed by finished.
+     */
+    void load();
+
+signals:
+    /*!
+     * Signal, which is emitted while the file is parsed and the graph is built.
+     * \param parsedBytes The count of parsed bytes.
+     * \param totalBytes The size of the file.
+     * \param addedEdges The count of edges added to the graph so far.
+     * \param totalEdges The count of edges to be added, 0 while the file is parsed.
+     */
+    void progressChanged(qint64 parsedBytes, qint64 totalBytes, qint64 addedEdges, qint64 totalEdges);
+    /*!
+     * Signal, which is emitted when the graph has been loaded.
+     * \param graph The graph, which is owned by the receiver.
+     */
+    void loaded(Graph* graph);
+    /*!
+     * Signal, which is emitted when the file could not be loaded.
+     * \param message The error's message.
+     */
+    void failed(const QString& message);
+    /*!
+     * Signal, which is emitted when the loading has been cancelled.
+     */
+    void cancelled();
+    /*!
+     * Signal, which is emitted after the loading has ended in any way.
+     */
+    void finished();
+
+private:
+    /*!
+     * The count of edges added at once, between which the progress is reported and the cancellation checked.
+     */
+    static const int EDGE_BATCH_SIZE = 1 << 20;
+
+    QString fileName;
+    FileFormat format;
+    QThread* resultThread;
+    std::atomic<bool> isCancelled;
+    bool isBinaryFileVerified;
+
+    /*!
+     * Loads a text graph file.
+     * \return The graph, nullptr if the loading was cancelled.
+     */
+    Graph* loadText();
+    /*!
+     * Imports a benchmark graph file.
+     * \param importFormat The format of the file.
+     * \return The graph, nullptr if the loading was cancelled.
+     */
+    Graph* loadImported(GraphImporter::Format importFormat);
+    /*!
+     * Builds a graph, adding the edges in batches, between which the progress is reported and the cancellation checked.
+     * \param nodeCount The count of the graph's nodes.
+     * \param edgeCount The count of the graph's edges announced by the file.
+     * \param edges The edges.
+     * \param totalBytes The size of the file.
+     * \param isTrusted Whether the edges are known to be valid and distinct.
+     * \return The graph, nullptr if the loading was cancelled.
+     */
+    Graph* buildGraph(int nodeCount, int edgeCount, const std::vector<Edge>& edges, qint64 totalBytes, bool isTrusted);
+    /*!
+     * Loads a binary graph file.
+     * \return The graph, nullptr if the loading was cancelled.
+     */
+    Graph* loadBinary();
+};
+
+#endif // GRAPHLOADER_H
@@ -101,6 +101,8 @@ void GraphWidget::paintEvent(QPaintEvent *event)
     painter.setPen(circlePen);
 
     auto nodeCoords = calculateNodeCoordinates(event);
+    const CsrGraph& adjacency = graph->freeze();
+    bool isLarge = graph->getCurrentNodeCount() > MAXIMUM_DRAWN_NODE_COUNT || graph->getCurrentEdgeCount() > MAXIMUM_DRAWN_EDGE_COUNT;
 
     painter.save();
     for (int i = 0; i < nodeCoords.size(); i++)
@@ -109,19 +111,32 @@ void GraphWidget::paintEvent(QPaintEvent *event)
 
         painter.setBrush(circleBrush);
         painter.setPen(circlePen);
-        // Draw node's circle
-        painter.drawEllipse(nodeRect);
+        // Draw node's circle, a large graph only shows its highlighted nodes
+        if (!isLarge || highlightedNodes.find(i) != highlightedNodes.end())
+        {
+            painter.drawEllipse(nodeRect);
+        }
 
-        Node* destHead = graph->head[i];
-        while (destHead != nullptr)
+        int edgeEnd = adjacency.getEdgeEnd(i);
+        for (int edge = adjacency.getEdgeBegin(i); edge < edgeEnd; edge++)
         {
-            auto destCoords = QPoint(nodeCoords[destHead->getValue()]); // center of destination node
+            int destination = adjacency.getTarget(edge);
+            int weight = adjacency.getWeight(edge);
+
+            // A large graph only shows its highlighted edges
+            bool isHighlighted = highlightedEdges.find(std::make_pair(i, destination)) != highlightedEdges.end();
+            if (isLarge && !isHighlighted)
+            {
+                continue;
+            }
+
+            auto destCoords = QPoint(nodeCoords[destination]); // center of destination node
             auto destRect = QRect(destCoords, NODE_RECT_SIZE);
             auto sourceDestLine = QLine(nodeRect.center(), destRect.center());
 
             QLineF borderToBorder;
             // Draw edges and arrow heads
-            if (highlightedEdges.find(std::make_pair(i, destHead->getValue())) != highlightedEdges.end())
+            if (isHighlighted)
             {
                 // Edge should be highlighted
                 painter.setPen(highlightPen);
@@ -137,7 +152,7 @@ void GraphWidget::paintEvent(QPaintEvent *event)
             // Draw weight along the edge
             // Get bounding rect depending on weight and font
             QFontMetrics fontMetrics(painter.font());
-            auto weightBoundingRect = fontMetrics.boundingRect(QString::number(destHead->getCost()));
+            auto weightBoundingRect = fontMetrics.boundingRect(QString::number(weight));
             // Accomodate space for border
             weightBoundingRect.setWidth(weightBoundingRect.width() + 4);
             weightBoundingRect.setHeight(weightBoundingRect.height() + 2);
@@ -145,7 +160,7 @@ void GraphWidget::paintEvent(QPaintEvent *event)
 
             // Divide the edge into 6 "bands" and place the weight on a band depending on source and dest values
             // In order to avoid overlap of weights when possible
-            qreal pointAlongEdget = float(((i + destHead->getValue()) % 6) + 1) / 7;
+            qreal pointAlongEdget = float(((i + destination) % 6) + 1) / 7;
             QPointF pointAlongEdge = borderToBorder.pointAt(pointAlongEdget);
             QPoint weightRectTopLeft(pointAlongEdge.x() - weightBoundingRect.width() / 2, pointAlongEdge.y() - weightBoundingRect.height() / 2);
             QRect weightRect = QRect(weightRectTopLeft, weightBoundingRect.size());
@@ -155,10 +170,8 @@ void GraphWidget::paintEvent(QPaintEvent *event)
             painter.setBrush(QBrush(Qt::white));
             painter.drawRect(weightRect);
             painter.setPen(QPen(Qt::darkGreen));
-            painter.drawText(weightRect, Qt::AlignCenter, QString::number(destHead->getCost()));
+            painter.drawText(weightRect, Qt::AlignCenter, QString::number(weight));
             painter.restore(); // restore previous pen and brush
-
-            destHead = destHead->getNextNode();
         }
     }
 
@@ -175,6 +188,11 @@ void GraphWidget::paintEvent(QPaintEvent *event)
     // Draw node's numbers at the end so that they are on top
     for (int i = 0; i < nodeCoords.size(); i++)
     {
+        if (isLarge && highlightedNodes.find(i) == highlightedNodes.end())
+        {
+            continue;
+        }
+
         auto nodeRect = QRect(nodeCoords[i], NODE_RECT_SIZE);
         painter.setPen(textPen);
         painter.drawText(nodeRect, Qt::AlignCenter, QString::number(i));
@@ -130,6 +130,12 @@ private:
 
     const QSize NODE_RECT_SIZE = QSize(20, 20);
     const int ARROW_HEAD_LENGTH = 10;
+    /*!
+     * The counts of nodes and edges, above which only the highlighted nodes and edges are drawn,
+     * as drawing all of them would block the GUI thread without showing anything legible
+     */
+    const int MAXIMUM_DRAWN_NODE_COUNT = 1000;
+    const int MAXIMUM_DRAWN_EDGE_COUNT = 5000;
 };
 
 
@@ -0,0 +1,316 @@
+#include "HubLabelIndex.h"
+#include "ContractionHierarchy.h"
+#include "DijkstraException.h"
+#include "DijkstraInputException.h"
+#include "IndexedDaryHeap.h"
+#include "ShortestPathWorkspace.h"
+#include <QFile>
+#include <QSaveFile>
+#include <algorithm>
+
+HubLabelIndex::HubLabelIndex()
+{
+    this->nodeCount = 0;
+    this->graph = nullptr;
+    this->graphVersion = 0;
+}
+
+HubLabelIndex::HubLabelIndex(const Graph& graph)
+{
+    // Pruning relies on settled costs being final, which needs non-negative weights
+    if (graph.hasNegativeEdgeWeights())
+    {
+        throw DijkstraException("Hub labels require non-negative edge weights.");
+    }
+
+    this->nodeCount = graph.getCurrentNodeCount();
+    this->graph = &graph;
+    this->graphVersion = graph.getVersion();
+
+    const CsrGraph& adjacency = graph.freeze();
+    const CsrGraph& reverseAdjacency = graph.freezeReverse();
+
+    // Nodes contracted late lie on many shortest paths, so processing them first as hubs prunes the later searches early
+    ContractionHierarchy hierarchy(graph);
+    std::vector<int> order(nodeCount);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        order[nodeCount - 1 - hierarchy.getRank(i)] = i;
+    }
+
+    std::vector<Label> outLabels(nodeCount);
+    std::vector<Label> inLabels(nodeCount);
+    std::vector<int> hubCosts(nodeCount, INT_MAX);
+    ShortestPathWorkspace workspace;
+
+    // Hubs are appended in processing order, so every label ends up sorted by hub position
+    for (int position = 0; position < nodeCount; position++)
+    {
+        int hub = order[position];
+        addHub(adjacency, hub, position, outLabels[hub], inLabels, hubCosts, workspace);
+        addHub(reverseAdjacency, hub, position, inLabels[hub], outLabels, hubCosts, workspace);
+    }
+
+    packLabels(outLabels, outOffsets, outHubs, outCosts);
+    std::vector<Label>().swap(outLabels);
+    packLabels(inLabels, inOffsets, inHubs, inCosts);
+}
+
+template<typename T>
+void HubLabelIndex::writeArray(QIODevice& file, const std::vector<T>& values)
+{
+    qint64 size = static_cast<qint64>(values.size() * sizeof(T));
+    if (file.write(reinterpret_cast<const char*>(values.data()), size) != size)
+    {
+        throw DijkstraException("Could not write hub label file.");
+    }
+}
+
+template<typename T>
+void HubLabelIndex::readArray(QFile& file, std::vector<T>& values, long long count)
+{
+    if (count < 0 || count > (file.size() - file.pos()) / static_cast<qint64>(sizeof(T)))
+    {
+        throw DijkstraException("Hub label file is truncated.");
+    }
+
+    values.resize(count);
+    qint64 size = static_cast<qint64>(count * sizeof(T));
+    if (file.read(reinterpret_cast<char*>(values.data()), size) != size)
+    {
+        throw DijkstraException("Hub label file is truncated.");
+    }
+}
+
+HubLabelIndex HubLabelIndex::load(const QString& fileName, const Graph& graph)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        throw DijkstraException("Could not open hub label file.");
+    }
+
+    int header[3];
+    if (file.read(reinterpret_cast<char*>(header), sizeof(header)) != sizeof(header) || header[0] != FILE_MAGIC || header[1] != FILE_VERSION
+        || header[2] < 0)
+    {
+        throw DijkstraException("File is not a compatible hub label file.");
+    }
+
+    if (header[2] != graph.getCurrentNodeCount())
+    {
+        throw DijkstraException("Hub label file does not match the graph.");
+    }
+
+    HubLabelIndex index;
+    index.nodeCount = header[2];
+    index.graph = &graph;
+    index.graphVersion = graph.getVersion();
+
+    readArray(file, index.outOffsets, index.nodeCount + 1LL);
+    readArray(file, index.outHubs, index.outOffsets.back());
+    readArray(file, index.outCosts, index.outOffsets.back());
+    readArray(file, index.inOffsets, index.nodeCount + 1LL);
+    readArray(file, index.inHubs, index.inOffsets.back());
+    readArray(file, index.inCosts, index.inOffsets.back());
+
+    if (file.pos() != file.size())
+    {
+        throw DijkstraException("Hub label file has unexpected trailing data.");
+    }
+
+    // The queries index the entries by the offsets without further checks
+    checkLabels(index.outOffsets, index.outHubs, index.nodeCount);
+    checkLabels(index.inOffsets, index.inHubs, index.nodeCount);
+
+    return index;
+}
+
+void HubLabelIndex::checkLabels(const std::vector<long long>& offsets, const std::vector<int>& hubs, int nodeCount)
+{
+    if (offsets.front() != 0 || offsets.back() != static_cast<long long>(hubs.size()))
+    {
+        throw DijkstraException("Hub label file is corrupt.");
+    }
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        if (offsets[i + 1] < offsets[i])
+        {
+            throw DijkstraException("Hub label file is corrupt.");
+        }
+
+        for (long long entry = offsets[i]; entry < offsets[i + 1]; entry++)
+        {
+            if (hubs[entry] < 0 || hubs[entry] >= nodeCount || (entry > offsets[i] && hubs[entry] <= hubs[entry - 1]))
+            {
+                throw DijkstraException("Hub label file is corrupt.");
+            }
+        }
+    }
+}
+
+void HubLabelIndex::save(const QString& fileName) const
+{
+    // The file is written aside and only renamed over the target when complete, so a failed save keeps the previous index
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        throw DijkstraException("Could not open hub label file.");
+    }
+
+    std::vector<int> header = { FILE_MAGIC, FILE_VERSION, nodeCount };
+    writeArray(file, header);
+    writeArray(file, outOffsets);
+    writeArray(file, outHubs);
+    writeArray(file, outCosts);
+    writeArray(file, inOffsets);
+    writeArray(file, inHubs);
+    writeArray(file, inCosts);
+
+    if (!file.commit())
+    {
+        throw DijkstraException("Could not write hub label file.");
+    }
+}
+
+int HubLabelIndex::distance(int source, int destination) const
+{
+    if (source < 0 || source >= nodeCount)
+    {
+        throw DijkstraInputException("Source does not exist in the graph.");
+    }
+
+    if (destination < 0 || destination >= nodeCount)
+    {
+        throw DijkstraInputException("Destination does not exist in the graph.");
+    }
+
+    // The labels do not know about edges added or reweighted after they were computed
+    if (graph->getVersion() != graphVersion)
+    {
+        throw DijkstraInputException("Graph has changed since the hub labels were computed.");
+    }
+
+    long long bestCost = INT_MAX;
+
+    // Both labels are sorted by hub position, so their common hubs are found in a single merge
+    long long i = outOffsets[source];
+    long long outEnd = outOffsets[source + 1];
+    long long j = inOffsets[destination];
+    long long inEnd = inOffsets[destination + 1];
+
+    while (i < outEnd && j < inEnd)
+    {
+        if (outHubs[i] < inHubs[j])
+        {
+            i++;
+        }
+        else if (outHubs[i] > inHubs[j])
+        {
+            j++;
+        }
+        else
+        {
+            bestCost = std::min(bestCost, static_cast<long long>(outCosts[i]) + inCosts[j]);
+            i++;
+            j++;
+        }
+    }
+
+    return static_cast<int>(bestCost);
+}
+
+int HubLabelIndex::getNodeCount() const
+{
+    return nodeCount;
+}
+
+long long HubLabelIndex::getLabelEntryCount() const
+{
+    return static_cast<long long>(outHubs.size() + inHubs.size());
+}
+
+void HubLabelIndex::addHub(const CsrGraph& adjacency, int hub, int position, const Label& hubLabel, std::vector<Label>& labels,
+                           std::vector<int>& hubCosts, ShortestPathWorkspace& workspace)
+{
+    for (const std::pair<int, int>& entry : hubLabel)
+    {
+        hubCosts[entry.first] = entry.second;
+    }
+
+    workspace.prepare(adjacency.getNodeCount());
+    IndexedDaryHeap<int, 4>& heap = workspace.getHeap();
+    workspace.setCost(hub, 0, -1);
+    heap.insert(hub, 0);
+
+    while (!heap.isEmpty())
+    {
+        int minimumNodeValue = heap.extractMinimum();
+        int minimumNodeCost = workspace.getCost(minimumNodeValue);
+
+        // The node is pruned if an earlier hub already covers a path at most as short
+        Label& label = labels[minimumNodeValue];
+        bool isCovered = false;
+        for (const std::pair<int, int>& entry : label)
+        {
+            if (hubCosts[entry.first] != INT_MAX && static_cast<long long>(hubCosts[entry.first]) + entry.second <= minimumNodeCost)
+            {
+                isCovered = true;
+                break;
+            }
+        }
+
+        if (isCovered)
+        {
+            continue;
+        }
+
+        label.push_back(std::make_pair(position, minimumNodeCost));
+
+        int edgeEnd = adjacency.getEdgeEnd(minimumNodeValue);
+        for (int edge = adjacency.getEdgeBegin(minimumNodeValue); edge < edgeEnd; edge++)
+        {
+            int value = adjacency.getTarget(edge);
+            long long newCost = static_cast<long long>(minimumNodeCost) + adjacency.getWeight(edge);
+
+            if (!heap.wasExtracted(value) && newCost < workspace.getCost(value))
+            {
+                workspace.setCost(value, static_cast<int>(newCost), minimumNodeValue);
+                if (heap.doesNodeExist(value))
+                {
+                    heap.decreaseCost(value, static_cast<int>(newCost));
+                }
+                else
+                {
+                    heap.insert(value, static_cast<int>(newCost));
+                }
+            }
+        }
+    }
+
+    for (const std::pair<int, int>& entry : hubLabel)
+    {
+        hubCosts[entry.first] = INT_MAX;
+    }
+}
+
+void HubLabelIndex::packLabels(const std::vector<Label>& labels, std::vector<long long>& offsets, std::vector<int>& hubs, std::vector<int>& costs)
+{
+    offsets.assign(labels.size() + 1, 0);
+    for (size_t i = 0; i < labels.size(); i++)
+    {
+        offsets[i + 1] = offsets[i] + static_cast<long long>(labels[i].size());
+    }
+
+    hubs.reserve(offsets.back());
+    costs.reserve(offsets.back());
+    for (const Label& label : labels)
+    {
+        for (const std::pair<int, int>& entry : label)
+        {
+            hubs.push_back(entry.first);
+            costs.push_back(entry.second);
+        }
+    }
+}
@@ -0,0 +1,143 @@
+#ifndef HUBLABELINDEX_H
+#define HUBLABELINDEX_H
+
+#include "Graph.h"
+#include "ShortestPathWorkspace.h"
+#include <QFile>
+#include <QString>
+#include <vector>
+
+/*!
+ * Represents a hub labeling of a graph, a distance oracle, which answers cost queries without searching the graph.
+ * Every node has an outgoing label with the costs to some hubs and an incoming label with the costs from some hubs,
+ * so that every shortest path passes through a hub in both the source's outgoing and the destination's incoming label.
+ * The labels are computed by pruned landmark labeling, which processes the nodes as hubs in reverse contraction hierarchy order
+ * and stops each search at nodes, whose cost the labels computed so far already give.
+ */
+class HubLabelIndex
+{
+public:
+    /*!
+     * Constructor, computes the labels of all nodes of the specified graph.
+     * \param graph The graph, which must have non-negative edge weights and outlive the index.
+     * The queries throw DijkstraInputException once the graph has changed.
+     */
+    HubLabelIndex(const Graph& graph);
+
+    /*!
+     * Loads an index saved by save, throws DijkstraException if it was computed for another node count.
+     * \param fileName The name of the file.
+     * \param graph The graph, which the index was computed for and which must outlive the index.
+     * The queries throw DijkstraInputException once the graph has changed.
+     * \return The index.
+     */
+    static HubLabelIndex load(const QString& fileName, const Graph& graph);
+    /*!
+     * Saves the index to a binary file, which can only be loaded on machines with the same byte order.
+     * The file is written under a temporary name and replaces the target once it is complete.
+     * \param fileName The name of the file.
+     */
+    void save(const QString& fileName) const;
+
+    /*!
+     * Calculates the shortest path cost between source and destination nodes by merging their labels,
+     * throws DijkstraInputException if a node does not exist or the graph has changed since the index was computed.
+     * \param source The source node.
+     * \param destination The destination node.
+     * \return The cost of the shortest path, INT_MAX if there is no path.
+     */
+    int distance(int source, int destination) const;
+
+    /*!
+     * Gets the count of nodes the index was computed for.
+     * \return The node count.
+     */
+    int getNodeCount() const;
+    /*!
+     * Gets the count of entries in all labels.
+     * \return The label entry count.
+     */
+    long long getLabelEntryCount() const;
+
+private:
+    /*!
+     * Identifies the file format, which also detects files written with a different byte order.
+     */
+    static const int FILE_MAGIC = 0x4C425548;
+    static const int FILE_VERSION = 1;
+
+    int nodeCount;
+    /*!
+     * The graph and its version, when the index was computed or loaded.
+     */
+    const Graph* graph;
+    unsigned long long graphVersion;
+
+    /*!
+     * The labels in compressed sparse row form, holding the hubs' positions in the processing order and the costs.
+     * Each label is sorted by hub position, which a query merges.
+     */
+    std::vector<long long> outOffsets;
+    std::vector<int> outHubs;
+    std::vector<int> outCosts;
+    std::vector<long long> inOffsets;
+    std::vector<int> inHubs;
+    std::vector<int> inCosts;
+
+    /*!
+     * Represents a label during the computation, an entry holds the hub's position and the cost.
+     */
+    typedef std::vector<std::pair<int, int>> Label;
+
+    /*!
+     * Constructor, creates an empty index to be loaded.
+     */
+    HubLabelIndex();
+
+    /*!
+     * Calculates the shortest path costs from a hub and adds it to the labels of the nodes, which the current labels do not cover.
+     * \param adjacency The adjacency to search, the reverse adjacency to fill the outgoing labels.
+     * \param hub The hub's node.
+     * \param position The hub's position in the processing order.
+     * \param hubLabel The hub's label in the opposite direction, which gives the first part of the covering paths.
+     * \param labels The labels to add the hub to.
+     * \param hubCosts The costs of hubLabel by hub position, INT_MAX elsewhere, restored before returning.
+     * \param workspace The workspace for the search.
+     */
+    static void addHub(const CsrGraph& adjacency, int hub, int position, const Label& hubLabel, std::vector<Label>& labels,
+                       std::vector<int>& hubCosts, ShortestPathWorkspace& workspace);
+    /*!
+     * Packs labels into compressed sparse row form.
+     * \param labels The labels.
+     * \param offsets Filled with the offset of every label, followed by the entry count.
+     * \param hubs Filled with the hub positions of all entries.
+     * \param costs Filled with the costs of all entries.
+     */
+    static void packLabels(const std::vector<Label>& labels, std::vector<long long>& offsets, std::vector<int>& hubs, std::vector<int>& costs);
+    /*!
+     * Writes the raw contents of an array to a file.
+     * \param file The open file.
+     * \param values The array.
+     */
+    template<typename T>
+    static void writeArray(QIODevice& file, const std::vector<T>& values);
+    /*!
+     * Reads the raw contents of an array from a file, throws DijkstraException if the rest of the file is too short.
+     * The size is checked before the array is allocated, so a corrupt count does not allocate memory.
+     * \param file The open file.
+     * \param values Filled with the array.
+     * \param count The count of elements to read.
+     */
+    template<typename T>
+    static void readArray(QFile& file, std::vector<T>& values, long long count);
+    /*!
+     * Checks loaded labels, throws DijkstraException if the offsets do not start at 0, decrease or do not end at the entry count,
+     * or if a label's hub positions are out of range or not ascending.
+     * \param offsets The offset of every label, followed by the entry count.
+     * \param hubs The hub positions of all entries.
+     * \param nodeCount The node count.
+     */
+    static void checkLabels(const std::vector<long long>& offsets, const std::vector<int>& hubs, int nodeCount);
+};
+
+#endif // HUBLABELINDEX_H
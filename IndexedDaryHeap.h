@@ -0,0 +1,257 @@
+#ifndef INDEXEDDARYHEAP_H
+#define INDEXEDDARYHEAP_H
+
+#include <vector>
+
+/*!
+ * Represents an indexed Min-Heap with a configurable arity, addressed by node value.
+ * The heap is stored as flat arrays (costs and values in heap order plus the position of every value),
+ * so inserting, decreasing and extracting nodes never allocates memory.
+ * \tparam Cost The type of the nodes' costs
+ * \tparam Arity The count of children of every heap node (2, 4 or 8)
+ */
+template<typename Cost, int Arity = 4>
+class IndexedDaryHeap
+{
+    static_assert(Arity == 2 || Arity == 4 || Arity == 8, "The heap's arity must be 2, 4 or 8.");
+
+public:
+    /*!
+     * Constructor - creates an empty heap, able to hold the values [0, capacity)
+     * \param capacity The capacity of the Heap
+     */
+    IndexedDaryHeap(int capacity);
+
+    /*!
+     * Function to determine if the Heap is empty
+     * \return bool If the Heap is empty
+     */
+    bool isEmpty() const;
+    /*!
+     * Function to return the count of the nodes in the Heap
+     * \return int Nodes count
+     */
+    int getNodesCount() const;
+    /*!
+     * Function to determine if a node with a given value is currently in the Heap
+     * \param value The value of a node
+     * \return bool Whether a node exists in the Heap
+     */
+    bool doesNodeExist(int value) const;
+    /*!
+     * Function to determine if a node with a given value has already been extracted from the Heap
+     * \param value The value of a node
+     * \return bool Whether the node has been extracted
+     */
+    bool wasExtracted(int value) const;
+
+    /*!
+     * Function used to insert a node, which is not in the Heap
+     * \param value Node's value
+     * \param cost Node's cost
+     */
+    void insert(int value, Cost cost);
+    /*!
+     * Function used to decrease cost value of a node in the Heap
+     * \param value Node's value
+     * \param cost The new cost
+     */
+    void decreaseCost(int value, Cost cost);
+    /*!
+     * Function used to return the cost of the minimum node without extracting it
+     * \return Cost The minimum cost
+     */
+    Cost getMinimumCost() const;
+    /*!
+     * Function used to extract the minimum node
+     * \return int The value of the extracted node
+     */
+    int extractMinimum();
+
+    /*!
+     * Function used to remove all nodes and forget which nodes have been extracted.
+     * Only the positions of the values, which have been inserted since the last clear, are reset.
+     */
+    void clear();
+
+private:
+    static constexpr int NOT_INSERTED = -1;
+    static constexpr int EXTRACTED = -2;
+
+    std::vector<Cost> costs;
+    std::vector<int> values;
+    std::vector<int> positions;
+    /*!
+     * The values inserted since the last clear, used to reset the positions
+     */
+    std::vector<int> insertedValues;
+
+    /*!
+     * Function used to move the node at the given index towards the root until its parent's cost is not greater
+     * \param index The node's index
+     * \param value The node's value
+     * \param cost The node's cost
+     */
+    void siftUp(int index, int value, Cost cost);
+    /*!
+     * Function used to move the node at the given index towards the leaves until its children's costs are not smaller
+     * \param index The node's index
+     * \param value The node's value
+     * \param cost The node's cost
+     */
+    void siftDown(int index, int value, Cost cost);
+};
+
+template<typename Cost, int Arity>
+IndexedDaryHeap<Cost, Arity>::IndexedDaryHeap(int capacity)
+{
+    costs.reserve(capacity);
+    values.reserve(capacity);
+    positions.assign(capacity, NOT_INSERTED);
+    insertedValues.reserve(capacity);
+}
+
+template<typename Cost, int Arity>
+inline bool IndexedDaryHeap<Cost, Arity>::isEmpty() const
+{
+    return values.empty();
+}
+
+template<typename Cost, int Arity>
+inline int IndexedDaryHeap<Cost, Arity>::getNodesCount() const
+{
+    return static_cast<int>(values.size());
+}
+
+template<typename Cost, int Arity>
+inline bool IndexedDaryHeap<Cost, Arity>::doesNodeExist(int value) const
+{
+    return positions[value] >= 0;
+}
+
+template<typename Cost, int Arity>
+inline bool IndexedDaryHeap<Cost, Arity>::wasExtracted(int value) const
+{
+    return positions[value] == EXTRACTED;
+}
+
+template<typename Cost, int Arity>
+inline void IndexedDaryHeap<Cost, Arity>::insert(int value, Cost cost)
+{
+    insertedValues.push_back(value);
+
+    // Append the node as the last leaf and restore the Min-Heap property from there
+    costs.push_back(cost);
+    values.push_back(value);
+    siftUp(getNodesCount() - 1, value, cost);
+}
+
+template<typename Cost, int Arity>
+inline void IndexedDaryHeap<Cost, Arity>::decreaseCost(int value, Cost cost)
+{
+    siftUp(positions[value], value, cost);
+}
+
+template<typename Cost, int Arity>
+inline Cost IndexedDaryHeap<Cost, Arity>::getMinimumCost() const
+{
+    return costs[0];
+}
+
+template<typename Cost, int Arity>
+inline int IndexedDaryHeap<Cost, Arity>::extractMinimum()
+{
+    int head = values[0];
+    positions[head] = EXTRACTED;
+
+    // Take the last node out and sift it down from the root's place
+    int lastValue = values.back();
+    Cost lastCost = costs.back();
+    values.pop_back();
+    costs.pop_back();
+
+    if (!values.empty())
+    {
+        siftDown(0, lastValue, lastCost);
+    }
+
+    return head;
+}
+
+template<typename Cost, int Arity>
+void IndexedDaryHeap<Cost, Arity>::clear()
+{
+    for (int value : insertedValues)
+    {
+        positions[value] = NOT_INSERTED;
+    }
+
+    insertedValues.clear();
+    costs.clear();
+    values.clear();
+}
+
+template<typename Cost, int Arity>
+inline void IndexedDaryHeap<Cost, Arity>::siftUp(int index, int value, Cost cost)
+{
+    // Move the parents down instead of swapping, the node is written once at its final place
+    while (index > 0)
+    {
+        int parent = (index - 1) / Arity;
+        if (!(cost < costs[parent]))
+        {
+            break;
+        }
+
+        costs[index] = costs[parent];
+        values[index] = values[parent];
+        positions[values[index]] = index;
+        index = parent;
+    }
+
+    costs[index] = cost;
+    values[index] = value;
+    positions[value] = index;
+}
+
+template<typename Cost, int Arity>
+inline void IndexedDaryHeap<Cost, Arity>::siftDown(int index, int value, Cost cost)
+{
+    int nodesCount = getNodesCount();
+
+    while (true)
+    {
+        int firstChild = Arity * index + 1;
+        if (firstChild >= nodesCount)
+        {
+            break;
+        }
+
+        // Find the child with the minimum cost
+        int lastChild = firstChild + Arity < nodesCount ? firstChild + Arity : nodesCount;
+        int minimumChild = firstChild;
+        for (int child = firstChild + 1; child < lastChild; child++)
+        {
+            if (costs[child] < costs[minimumChild])
+            {
+                minimumChild = child;
+            }
+        }
+
+        if (!(costs[minimumChild] < cost))
+        {
+            break;
+        }
+
+        costs[index] = costs[minimumChild];
+        values[index] = values[minimumChild];
+        positions[values[index]] = index;
+        index = minimumChild;
+    }
+
+    costs[index] = cost;
+    values[index] = value;
+    positions[value] = index;
+}
+
+#endif // INDEXEDDARYHEAP_H
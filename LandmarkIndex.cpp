@@ -0,0 +1,318 @@
+#include "LandmarkIndex.h"
+#include "DijkstraException.h"
+#include "DijkstraInputException.h"
+#include "IndexedDaryHeap.h"
+#include <random>
+
+LandmarkIndex::LandmarkIndex(const Graph& graph, int landmarkCount, Selection selection)
+    : graph(graph)
+{
+    // Lower bounds from the triangle inequality are only valid for non-negative weights
+    if (graph.hasNegativeEdgeWeights())
+    {
+        throw DijkstraException("Landmarks require non-negative edge weights.");
+    }
+
+    this->nodeCount = graph.getCurrentNodeCount();
+    this->graphVersion = graph.getVersion();
+    this->tableWidth = 0;
+
+    if (landmarkCount > nodeCount)
+    {
+        landmarkCount = nodeCount;
+    }
+
+    if (landmarkCount <= 0)
+    {
+        return;
+    }
+
+    // The tables are stored node after node, so the bounds of a node are read from a single cache line
+    tableWidth = landmarkCount;
+    costsFromLandmarks.assign(static_cast<size_t>(nodeCount) * landmarkCount, INT_MAX);
+    costsToLandmarks.assign(static_cast<size_t>(nodeCount) * landmarkCount, INT_MAX);
+    landmarks.reserve(landmarkCount);
+
+    // The random roots of the avoid strategy are seeded with a constant, so the same graph always gets the same landmarks
+    std::mt19937 random(landmarkCount);
+
+    while (static_cast<int>(landmarks.size()) < landmarkCount)
+    {
+        int landmark = -1;
+
+        if (landmarks.empty())
+        {
+            // Start with the node farthest from an arbitrary node
+            std::vector<int> costs(nodeCount);
+            calculateCosts(graph.freeze(), 0, costs.data(), nullptr, nullptr);
+
+            landmark = 0;
+            for (int i = 0; i < nodeCount; i++)
+            {
+                if (costs[i] != INT_MAX && costs[i] > costs[landmark])
+                {
+                    landmark = i;
+                }
+            }
+        }
+        else if (selection == Selection::Avoid)
+        {
+            landmark = selectAvoid(graph, random() % nodeCount);
+        }
+
+        // The farthest node also replaces an avoid selection, which has only found landmarks
+        if (landmark == -1)
+        {
+            landmark = selectFarthest();
+        }
+
+        addLandmark(graph, landmark);
+    }
+}
+
+void LandmarkIndex::checkVersion() const
+{
+    // The cost tables do not know about edges added or reweighted after they were computed, their bounds may be too high
+    if (graph.getVersion() != graphVersion)
+    {
+        throw DijkstraInputException("Graph has changed since the landmarks were computed.");
+    }
+}
+
+int LandmarkIndex::getLandmarkCount() const
+{
+    return static_cast<int>(landmarks.size());
+}
+
+int LandmarkIndex::getLandmark(int index) const
+{
+    return landmarks[index];
+}
+
+int LandmarkIndex::getCostFromLandmark(int index, int node) const
+{
+    return costsFromLandmarks[static_cast<size_t>(node) * tableWidth + index];
+}
+
+int LandmarkIndex::getCostToLandmark(int index, int node) const
+{
+    return costsToLandmarks[static_cast<size_t>(node) * tableWidth + index];
+}
+
+int LandmarkIndex::getLowerBound(int node, int destination) const
+{
+    int landmarkCount = static_cast<int>(landmarks.size());
+    size_t stride = tableWidth;
+    const int* fromNode = &costsFromLandmarks[node * stride];
+    const int* fromDestination = &costsFromLandmarks[destination * stride];
+    const int* toNode = &costsToLandmarks[node * stride];
+    const int* toDestination = &costsToLandmarks[destination * stride];
+
+    int bound = 0;
+
+    for (int i = 0; i < landmarkCount; i++)
+    {
+        // cost(landmark, destination) <= cost(landmark, node) + cost(node, destination)
+        if (fromNode[i] != INT_MAX)
+        {
+            // If the landmark reaches the node, but not the destination, the node can not reach the destination either
+            if (fromDestination[i] == INT_MAX)
+            {
+                return INT_MAX;
+            }
+
+            if (fromDestination[i] - fromNode[i] > bound)
+            {
+                bound = fromDestination[i] - fromNode[i];
+            }
+        }
+
+        // cost(node, landmark) <= cost(node, destination) + cost(destination, landmark)
+        if (toDestination[i] != INT_MAX)
+        {
+            // If the destination reaches the landmark, but the node does not, the node can not reach the destination
+            if (toNode[i] == INT_MAX)
+            {
+                return INT_MAX;
+            }
+
+            if (toNode[i] - toDestination[i] > bound)
+            {
+                bound = toNode[i] - toDestination[i];
+            }
+        }
+    }
+
+    return bound;
+}
+
+void LandmarkIndex::addLandmark(const Graph& graph, int landmark)
+{
+    int index = static_cast<int>(landmarks.size());
+    size_t stride = tableWidth;
+
+    std::vector<int> costs(nodeCount);
+
+    calculateCosts(graph.freeze(), landmark, costs.data(), nullptr, nullptr);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        costsFromLandmarks[i * stride + index] = costs[i];
+    }
+
+    calculateCosts(graph.freezeReverse(), landmark, costs.data(), nullptr, nullptr);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        costsToLandmarks[i * stride + index] = costs[i];
+    }
+
+    landmarks.push_back(landmark);
+}
+
+int LandmarkIndex::selectFarthest() const
+{
+    int farthestNode = -1;
+    int farthestCost = -1;
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        // The distance of a node to the landmarks is its cost from the closest landmark
+        int cost = INT_MAX;
+        bool isLandmark = false;
+        for (int j = 0; j < static_cast<int>(landmarks.size()); j++)
+        {
+            if (landmarks[j] == i)
+            {
+                isLandmark = true;
+                break;
+            }
+
+            if (getCostFromLandmark(j, i) < cost)
+            {
+                cost = getCostFromLandmark(j, i);
+            }
+        }
+
+        if (!isLandmark && cost > farthestCost)
+        {
+            farthestNode = i;
+            farthestCost = cost;
+        }
+    }
+
+    return farthestNode;
+}
+
+int LandmarkIndex::selectAvoid(const Graph& graph, int root) const
+{
+    std::vector<int> costs(nodeCount);
+    std::vector<int> path(nodeCount);
+    std::vector<int> order;
+    calculateCosts(graph.freeze(), root, costs.data(), path.data(), &order);
+
+    // The size of a subtree is the sum of how much the current bounds underestimate the costs from the root,
+    // subtrees containing a landmark are already covered and get no size
+    std::vector<long long> sizes(nodeCount, 0);
+    std::vector<char> hasLandmark(nodeCount, 0);
+    std::vector<int> largestChild(nodeCount, -1);
+
+    for (int landmark : landmarks)
+    {
+        hasLandmark[landmark] = 1;
+    }
+
+    for (int i = static_cast<int>(order.size()) - 1; i >= 0; i--)
+    {
+        int node = order[i];
+        sizes[node] += costs[node] - getLowerBound(root, node);
+
+        if (hasLandmark[node])
+        {
+            sizes[node] = 0;
+        }
+
+        int parent = path[node];
+        if (parent != -1)
+        {
+            if (hasLandmark[node])
+            {
+                hasLandmark[parent] = 1;
+            }
+
+            sizes[parent] += sizes[node];
+
+            if (sizes[node] > 0 && (largestChild[parent] == -1 || sizes[node] > sizes[largestChild[parent]]))
+            {
+                largestChild[parent] = node;
+            }
+        }
+    }
+
+    // Descend into the largest subtree until a leaf is reached
+    int node = root;
+    while (largestChild[node] != -1)
+    {
+        node = largestChild[node];
+    }
+
+    for (int landmark : landmarks)
+    {
+        if (landmark == node)
+        {
+            return -1;
+        }
+    }
+
+    return node;
+}
+
+void LandmarkIndex::calculateCosts(const CsrGraph& adjacency, int source, int* costs, int* path, std::vector<int>* order)
+{
+    int nodeCount = adjacency.getNodeCount();
+    IndexedDaryHeap<int, 4> heap(nodeCount);
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        costs[i] = INT_MAX;
+        if (path)
+        {
+            path[i] = -1;
+        }
+    }
+
+    costs[source] = 0;
+    heap.insert(source, 0);
+
+    while (!heap.isEmpty())
+    {
+        int minimumNodeValue = heap.extractMinimum();
+        if (order)
+        {
+            order->push_back(minimumNodeValue);
+        }
+
+        int edgeEnd = adjacency.getEdgeEnd(minimumNodeValue);
+        for (int edge = adjacency.getEdgeBegin(minimumNodeValue); edge < edgeEnd; ++edge)
+        {
+            int value = adjacency.getTarget(edge);
+            int newCost = adjacency.getWeight(edge) + costs[minimumNodeValue];
+
+            if (newCost < costs[value])
+            {
+                costs[value] = newCost;
+                if (path)
+                {
+                    path[value] = minimumNodeValue;
+                }
+
+                if (heap.doesNodeExist(value))
+                {
+                    heap.decreaseCost(value, newCost);
+                }
+                else
+                {
+                    heap.insert(value, newCost);
+                }
+            }
+        }
+    }
+}
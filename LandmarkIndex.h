@@ -0,0 +1,125 @@
+#ifndef LANDMARKINDEX_H
+#define LANDMARKINDEX_H
+
+#include "Graph.h"
+#include <vector>
+
+/*!
+ * Represents the preprocessing of the ALT algorithm (A*, landmarks and the triangle inequality).
+ * For a few landmark nodes it stores the shortest path costs from every landmark to every node and from every node to every landmark,
+ * which give lower bounds of the cost between any two nodes.
+ */
+class LandmarkIndex
+{
+public:
+    /*!
+     * Represents the strategies for choosing the landmarks.
+     * Farthest repeatedly picks the node farthest from the landmarks chosen so far.
+     * Avoid grows a shortest path tree from a random node and picks a leaf of the subtree, whose nodes have the worst lower bounds.
+     */
+    enum class Selection
+    {
+        Farthest,
+        Avoid
+    };
+
+    /*!
+     * Constructor, chooses the landmarks and computes their cost tables.
+     * \param graph The graph, which must have non-negative edge weights and outlive the index. The index is outdated after the graph changes.
+     * \param landmarkCount The count of landmarks to choose, limited by the graph's node count.
+     * \param selection The strategy for choosing the landmarks.
+     */
+    LandmarkIndex(const Graph& graph, int landmarkCount, Selection selection = Selection::Avoid);
+
+    /*!
+     * Checks whether the graph has changed since the landmarks were computed, throws DijkstraInputException if it has.
+     * The searches check it once per query, as the bounds are read too often to check them on every read.
+     */
+    void checkVersion() const;
+
+    /*!
+     * Gets the count of landmarks.
+     * \return The landmark count.
+     */
+    int getLandmarkCount() const;
+    /*!
+     * Gets a landmark.
+     * \param index The landmark's index.
+     * \return The landmark's node.
+     */
+    int getLandmark(int index) const;
+    /*!
+     * Gets the shortest path cost from a landmark to a node.
+     * \param index The landmark's index.
+     * \param node The node.
+     * \return The cost, INT_MAX if the node is unreachable from the landmark.
+     */
+    int getCostFromLandmark(int index, int node) const;
+    /*!
+     * Gets the shortest path cost from a node to a landmark.
+     * \param index The landmark's index.
+     * \param node The node.
+     * \return The cost, INT_MAX if the landmark is unreachable from the node.
+     */
+    int getCostToLandmark(int index, int node) const;
+
+    /*!
+     * Gets a lower bound of the shortest path cost between two nodes.
+     * \param node The node, from which the path starts.
+     * \param destination The node, at which the path ends.
+     * \return The lower bound, INT_MAX if the landmarks prove that there is no path.
+     */
+    int getLowerBound(int node, int destination) const;
+
+private:
+    int nodeCount;
+    /*!
+     * The graph and its version, when the landmarks were computed.
+     */
+    const Graph& graph;
+    unsigned long long graphVersion;
+    std::vector<int> landmarks;
+    /*!
+     * The count of table entries per node, the requested landmark count.
+     */
+    size_t tableWidth;
+    /*!
+     * The costs from the landmarks, node after node, tableWidth entries each.
+     */
+    std::vector<int> costsFromLandmarks;
+    /*!
+     * The costs to the landmarks, node after node, tableWidth entries each.
+     */
+    std::vector<int> costsToLandmarks;
+
+    /*!
+     * Adds a landmark and computes its cost tables.
+     * \param graph The graph.
+     * \param landmark The new landmark.
+     */
+    void addLandmark(const Graph& graph, int landmark);
+    /*!
+     * Chooses the node farthest from all current landmarks, preferring nodes no landmark reaches.
+     * \return The chosen node, -1 if all nodes are landmarks.
+     */
+    int selectFarthest() const;
+    /*!
+     * Chooses a landmark with the avoid strategy, using a shortest path tree from the specified root.
+     * \param graph The graph.
+     * \param root The root of the shortest path tree.
+     * \return The chosen node, -1 if the tree does not offer a node, which is not a landmark.
+     */
+    int selectAvoid(const Graph& graph, int root) const;
+
+    /*!
+     * Calculates the shortest path costs from a node over an adjacency.
+     * \param adjacency The adjacency to search (the reverse adjacency gives the costs to the node).
+     * \param source The node to start from.
+     * \param costs Filled with the costs, INT_MAX for unreachable nodes.
+     * \param path If not null, filled with the previous node of every node, -1 for the source and unreachable nodes.
+     * \param order If not null, filled with the nodes in the order they were settled.
+     */
+    static void calculateCosts(const CsrGraph& adjacency, int source, int* costs, int* path, std::vector<int>* order);
+};
+
+#endif // LANDMARKINDEX_H
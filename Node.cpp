@@ -17,6 +17,11 @@ int Node::getCost() const
     return cost;
 }
 
+void Node::setCost(int cost)
+{
+    this->cost = cost;
+}
+
 Node* Node::getNextNode()
 {
     return next;
@@ -25,6 +25,11 @@ public:
      * \return The node's cost.
      */
     int getCost() const;
+    /*!
+     * Sets the node's cost.
+     * \param cost The new cost.
+     */
+    void setCost(int cost);
     /*!
      * Gets the node's next node.
      * \return The next node.
@@ -0,0 +1,54 @@
+#include "NodeArena.h"
+#include <algorithm>
+#include <new>
+#include <type_traits>
+
+static_assert(std::is_trivially_destructible<Node>::value, "NodeArena does not destroy its nodes.");
+
+NodeArena::NodeArena()
+{
+    this->position = nullptr;
+    this->end = nullptr;
+    this->nextChunkSize = MINIMUM_CHUNK_SIZE;
+}
+
+Node* NodeArena::create(int value, int cost, Node* head)
+{
+    if (position == end)
+    {
+        allocateChunk(nextChunkSize);
+        nextChunkSize = std::min(nextChunkSize * 2, MAXIMUM_CHUNK_SIZE);
+    }
+
+    return new (position++) Node(value, cost, head);
+}
+
+void NodeArena::reserve(size_t nodeCount)
+{
+    // The rest of the current chunk is abandoned, which wastes less than one chunk
+    if (static_cast<size_t>(end - position) < nodeCount)
+    {
+        allocateChunk(std::max(nodeCount, nextChunkSize));
+    }
+}
+
+void NodeArena::clear()
+{
+    std::vector<std::unique_ptr<char[]>>().swap(chunks);
+    position = nullptr;
+    end = nullptr;
+    nextChunkSize = MINIMUM_CHUNK_SIZE;
+}
+
+size_t NodeArena::getChunkCount() const
+{
+    return chunks.size();
+}
+
+void NodeArena::allocateChunk(size_t nodeCount)
+{
+    // The memory of new[] is aligned for any fundamental type, so the nodes can be placed at its start
+    chunks.push_back(std::unique_ptr<char[]>(new char[nodeCount * sizeof(Node)]));
+    position = reinterpret_cast<Node*>(chunks.back().get());
+    end = position + nodeCount;
+}
@@ -0,0 +1,71 @@
+#ifndef NODEARENA_H
+#define NODEARENA_H
+
+#include "Node.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/*!
+ * Represents the storage of a graph's adjacency list nodes, which are allocated in chunks and freed all at once.
+ * Creating a node only bumps a position in the current chunk, so filling a graph does not call the allocator per edge,
+ * and destroying the arena frees one block per chunk. Nodes are never freed individually.
+ */
+class NodeArena
+{
+public:
+    /*!
+     * Default constructor, creates an empty arena, which allocates its first chunk on the first node.
+     */
+    NodeArena();
+
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    /*!
+     * Creates a node in the arena, which stays valid until the arena is destroyed.
+     * \param value The node's value.
+     * \param cost The node's cost.
+     * \param head The node's head.
+     * \return The new node.
+     */
+    Node* create(int value, int cost, Node* head);
+    /*!
+     * Makes room for the specified count of nodes, so creating them does not allocate more than once.
+     * \param nodeCount The count of nodes.
+     */
+    void reserve(size_t nodeCount);
+    /*!
+     * Frees all chunks, which invalidates all nodes created so far.
+     */
+    void clear();
+
+    /*!
+     * Gets the count of allocated chunks.
+     * \return The chunk count.
+     */
+    size_t getChunkCount() const;
+
+private:
+    /*!
+     * The node count of the first chunk, every further chunk doubles it up to the maximum.
+     */
+    static constexpr size_t MINIMUM_CHUNK_SIZE = 1024;
+    static constexpr size_t MAXIMUM_CHUNK_SIZE = 1 << 20;
+
+    /*!
+     * The chunks' raw memory, Node is trivially destructible, so the nodes do not need to be destroyed.
+     */
+    std::vector<std::unique_ptr<char[]>> chunks;
+    Node* position;
+    Node* end;
+    size_t nextChunkSize;
+
+    /*!
+     * Allocates a new chunk, which the following nodes are created in.
+     * \param nodeCount The chunk's node count.
+     */
+    void allocateChunk(size_t nodeCount);
+};
+
+#endif // NODEARENA_H
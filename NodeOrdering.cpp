@@ -0,0 +1,187 @@
+#include "NodeOrdering.h"
+#include <algorithm>
+#include <utility>
+
+std::vector<int> NodeOrdering::computeOrder(const CsrGraph& adjacency, Type type)
+{
+    int nodeCount = adjacency.getNodeCount();
+    std::vector<int> order(nodeCount);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        order[i] = i;
+    }
+
+    if (type == Type::Original)
+    {
+        return order;
+    }
+
+    UndirectedGraph graph = buildUndirectedGraph(adjacency);
+    std::vector<int> parts(nodeCount, 0);
+    std::vector<unsigned int> stamps(nodeCount, 0);
+    unsigned int lastStamp = 0;
+
+    if (type != Type::Partition)
+    {
+        orderBreadthFirst(graph, order, parts, stamps, lastStamp, type == Type::ReverseCuthillMcKee);
+        if (type == Type::ReverseCuthillMcKee)
+        {
+            std::reverse(order.begin(), order.end());
+        }
+
+        return order;
+    }
+
+    // Split every part in the middle of its breadth first order, the halves are contiguous ranges of the order
+    std::vector<std::pair<int, int>> ranges(1, std::make_pair(0, nodeCount));
+    std::vector<int> nodes;
+    int lastPart = 0;
+    while (!ranges.empty())
+    {
+        std::pair<int, int> range = ranges.back();
+        ranges.pop_back();
+
+        lastPart++;
+        nodes.assign(order.begin() + range.first, order.begin() + range.second);
+        for (int node : nodes)
+        {
+            parts[node] = lastPart;
+        }
+
+        orderBreadthFirst(graph, nodes, parts, stamps, lastStamp, false);
+        std::copy(nodes.begin(), nodes.end(), order.begin() + range.first);
+
+        if (range.second - range.first > PARTITION_LEAF_SIZE)
+        {
+            int middle = range.first + (range.second - range.first) / 2;
+            ranges.push_back(std::make_pair(middle, range.second));
+            ranges.push_back(std::make_pair(range.first, middle));
+        }
+    }
+
+    return order;
+}
+
+CsrGraph NodeOrdering::permute(const CsrGraph& adjacency, const std::vector<int>& ranks)
+{
+    int nodeCount = adjacency.getNodeCount();
+    std::vector<int> offsets(nodeCount + 1, 0);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        offsets[ranks[i] + 1] = adjacency.getEdgeEnd(i) - adjacency.getEdgeBegin(i);
+    }
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        offsets[i + 1] += offsets[i];
+    }
+
+    std::vector<int> targets(adjacency.getEdgeCount());
+    std::vector<int> weights(adjacency.getEdgeCount());
+    for (int i = 0; i < nodeCount; i++)
+    {
+        int position = offsets[ranks[i]];
+        for (int edge = adjacency.getEdgeBegin(i); edge < adjacency.getEdgeEnd(i); edge++)
+        {
+            targets[position] = ranks[adjacency.getTarget(edge)];
+            weights[position] = adjacency.getWeight(edge);
+            position++;
+        }
+    }
+
+    return CsrGraph(nodeCount, std::move(offsets), std::move(targets), std::move(weights));
+}
+
+NodeOrdering::UndirectedGraph NodeOrdering::buildUndirectedGraph(const CsrGraph& adjacency)
+{
+    int nodeCount = adjacency.getNodeCount();
+    UndirectedGraph graph;
+
+    // Every edge is counted at both ends, an edge, which exists in both directions, appears twice, which the searches tolerate
+    graph.offsets.assign(nodeCount + 1, 0);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        for (int edge = adjacency.getEdgeBegin(i); edge < adjacency.getEdgeEnd(i); edge++)
+        {
+            graph.offsets[i + 1]++;
+            graph.offsets[adjacency.getTarget(edge) + 1]++;
+        }
+    }
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        graph.offsets[i + 1] += graph.offsets[i];
+    }
+
+    graph.neighbours.resize(graph.offsets[nodeCount]);
+    std::vector<int> positions(graph.offsets.begin(), graph.offsets.end() - 1);
+    for (int i = 0; i < nodeCount; i++)
+    {
+        for (int edge = adjacency.getEdgeBegin(i); edge < adjacency.getEdgeEnd(i); edge++)
+        {
+            int target = adjacency.getTarget(edge);
+            graph.neighbours[positions[i]++] = target;
+            graph.neighbours[positions[target]++] = i;
+        }
+    }
+
+    return graph;
+}
+
+int NodeOrdering::searchBreadthFirst(const UndirectedGraph& graph, int start, const std::vector<int>& parts, std::vector<unsigned int>& stamps,
+                                     unsigned int stamp, bool isSortedByDegree, std::vector<int>& visited)
+{
+    int part = parts[start];
+    size_t position = visited.size();
+    stamps[start] = stamp;
+    visited.push_back(start);
+
+    while (position < visited.size())
+    {
+        int node = visited[position++];
+        size_t discovered = visited.size();
+        for (int i = graph.offsets[node]; i < graph.offsets[node + 1]; i++)
+        {
+            int neighbour = graph.neighbours[i];
+            if (parts[neighbour] == part && stamps[neighbour] != stamp)
+            {
+                stamps[neighbour] = stamp;
+                visited.push_back(neighbour);
+            }
+        }
+
+        if (isSortedByDegree)
+        {
+            std::stable_sort(visited.begin() + discovered, visited.end(), [&graph](int first, int second)
+            {
+                return graph.offsets[first + 1] - graph.offsets[first] < graph.offsets[second + 1] - graph.offsets[second];
+            });
+        }
+    }
+
+    return visited.back();
+}
+
+void NodeOrdering::orderBreadthFirst(const UndirectedGraph& graph, std::vector<int>& nodes, const std::vector<int>& parts,
+                                     std::vector<unsigned int>& stamps, unsigned int& lastStamp, bool isSortedByDegree)
+{
+    std::vector<int> order;
+    std::vector<int> probe;
+    order.reserve(nodes.size());
+    unsigned int orderStamp = ++lastStamp;
+
+    for (int node : nodes)
+    {
+        if (stamps[node] == orderStamp)
+        {
+            continue;
+        }
+
+        // A search from the farthest node of a first search spans more levels of fewer nodes each, which keeps neighbours closer
+        probe.clear();
+        int peripheralNode = searchBreadthFirst(graph, node, parts, stamps, ++lastStamp, false, probe);
+        searchBreadthFirst(graph, peripheralNode, parts, stamps, orderStamp, isSortedByDegree, order);
+    }
+
+    nodes.swap(order);
+}
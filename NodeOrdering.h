@@ -0,0 +1,90 @@
+#ifndef NODEORDERING_H
+#define NODEORDERING_H
+
+#include "CsrGraph.h"
+#include <vector>
+
+/*!
+ * Computes orders of a graph's nodes, which place nodes close to each other in the graph close to each other in memory.
+ * Renumbering the nodes by such an order makes the shortest path search touch fewer cache lines of the adjacency and the costs.
+ */
+class NodeOrdering
+{
+public:
+    /*!
+     * Represents the orders, which can be computed. The edges are treated as undirected by all of them.
+     * BreadthFirst numbers the nodes in the order a breadth first search reaches them,
+     * ReverseCuthillMcKee does the same, visiting the neighbours by ascending degree, and reverses the result,
+     * Partition bisects the graph recursively along breadth first searches, so every part occupies a contiguous range.
+     */
+    enum class Type
+    {
+        Original,
+        BreadthFirst,
+        ReverseCuthillMcKee,
+        Partition
+    };
+
+    /*!
+     * Computes an order of the nodes of a graph.
+     * \param adjacency The graph's adjacency.
+     * \param type The order's type.
+     * \return The nodes in their new order, the original node of every new id.
+     */
+    static std::vector<int> computeOrder(const CsrGraph& adjacency, Type type);
+    /*!
+     * Renumbers the nodes of an adjacency.
+     * \param adjacency The adjacency.
+     * \param ranks The new id of every node.
+     * \return The renumbered adjacency, the edges of every node keep their order.
+     */
+    static CsrGraph permute(const CsrGraph& adjacency, const std::vector<int>& ranks);
+
+private:
+    /*!
+     * The node count, up to which Partition stops bisecting a part.
+     */
+    static const int PARTITION_LEAF_SIZE = 128;
+
+    /*!
+     * Represents the graph with every edge in both directions.
+     */
+    struct UndirectedGraph
+    {
+        std::vector<int> offsets;
+        std::vector<int> neighbours;
+    };
+
+    /*!
+     * Builds the undirected graph of an adjacency.
+     * \param adjacency The adjacency.
+     * \return The undirected graph.
+     */
+    static UndirectedGraph buildUndirectedGraph(const CsrGraph& adjacency);
+    /*!
+     * Searches breadth first from a node, visiting only the nodes of its part, which are not stamped yet.
+     * \param graph The undirected graph.
+     * \param start The start node.
+     * \param parts The part of every node.
+     * \param stamps The stamp of every node, set for the visited nodes.
+     * \param stamp The stamp of this search.
+     * \param isSortedByDegree Whether the neighbours of a node are visited by ascending degree.
+     * \param visited Appended with the visited nodes in their order.
+     * \return The last visited node, which lies in the farthest level of the search.
+     */
+    static int searchBreadthFirst(const UndirectedGraph& graph, int start, const std::vector<int>& parts, std::vector<unsigned int>& stamps,
+                                  unsigned int stamp, bool isSortedByDegree, std::vector<int>& visited);
+    /*!
+     * Orders nodes by breadth first searches, one per connected component, each from a node far from the component's first node.
+     * \param graph The undirected graph.
+     * \param nodes The nodes, which must form one part and are replaced with their order.
+     * \param parts The part of every node.
+     * \param stamps The stamp of every node.
+     * \param lastStamp The last used stamp, advanced by the searches.
+     * \param isSortedByDegree Whether the neighbours of a node are visited by ascending degree.
+     */
+    static void orderBreadthFirst(const UndirectedGraph& graph, std::vector<int>& nodes, const std::vector<int>& parts,
+                                  std::vector<unsigned int>& stamps, unsigned int& lastStamp, bool isSortedByDegree);
+};
+
+#endif // NODEORDERING_H
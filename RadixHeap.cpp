@@ -0,0 +1,48 @@
+#include "RadixHeap.h"
+
+RadixHeap::RadixHeap()
+{
+    this->lastCost = 0;
+    this->nodesCount = 0;
+}
+
+void RadixHeap::redistribute()
+{
+    // Find the first non-empty bucket
+    int bucket = 1;
+    while (buckets[bucket].empty())
+    {
+        bucket++;
+    }
+
+    // The minimum cost in the bucket becomes the last extracted cost
+    unsigned int minimumCost = buckets[bucket][0].cost;
+    for (const Entry& entry : buckets[bucket])
+    {
+        if (entry.cost < minimumCost)
+        {
+            minimumCost = entry.cost;
+        }
+    }
+
+    lastCost = minimumCost;
+
+    // Every node of the bucket now differs from the last extracted cost in a lower bit, so it moves to a lower bucket
+    for (const Entry& entry : buckets[bucket])
+    {
+        buckets[getBucket(entry.cost)].push_back(entry);
+    }
+
+    buckets[bucket].clear();
+}
+
+void RadixHeap::clear()
+{
+    for (std::vector<Entry>& bucket : buckets)
+    {
+        bucket.clear();
+    }
+
+    lastCost = 0;
+    nodesCount = 0;
+}
@@ -0,0 +1,127 @@
+#ifndef RADIXHEAP_H
+#define RADIXHEAP_H
+
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/*!
+ * Represents a monotone priority queue of nodes with non-negative integer costs (radix heap).
+ * A node is kept in the bucket given by the highest bit in which its cost differs from the last extracted cost,
+ * so every node is moved at most once per bit on its way to bucket 0.
+ * Decreasing a node's cost is done by inserting it again, outdated entries have to be skipped by the caller.
+ */
+class RadixHeap
+{
+public:
+    /*!
+     * Constructor - creates an empty heap
+     */
+    RadixHeap();
+
+    /*!
+     * Function to determine if the heap is empty
+     * \return bool If the heap is empty
+     */
+    bool isEmpty() const;
+    /*!
+     * Function used to insert a node. The cost must not be smaller than the last extracted cost.
+     * \param value Node's value
+     * \param cost Node's cost
+     */
+    void insert(int value, int cost);
+    /*!
+     * Function used to extract a node with the minimum cost
+     * \return int The value of the extracted node
+     */
+    int extractMinimum();
+    /*!
+     * Function used to return the cost of the last extracted node
+     * \return int The cost of the last extracted node
+     */
+    int getLastExtractedCost() const;
+
+    /*!
+     * Function used to remove all nodes, the buckets' memory is kept for the next search
+     */
+    void clear();
+
+private:
+    /*!
+     * Represents a node in a bucket
+     */
+    struct Entry
+    {
+        unsigned int cost;
+        int value;
+    };
+
+    static const int BUCKETS_COUNT = 33;
+
+    std::vector<Entry> buckets[BUCKETS_COUNT];
+    unsigned int lastCost;
+    int nodesCount;
+
+    /*!
+     * Function used to return the bucket of a cost relative to the last extracted cost
+     * \param cost The cost
+     * \return int The bucket's index
+     */
+    int getBucket(unsigned int cost) const;
+    /*!
+     * Function used to move the nodes of the first non-empty bucket to lower buckets,
+     * after the last extracted cost is set to their minimum cost
+     */
+    void redistribute();
+};
+
+inline bool RadixHeap::isEmpty() const
+{
+    return nodesCount == 0;
+}
+
+inline int RadixHeap::getBucket(unsigned int cost) const
+{
+    if (cost == lastCost)
+    {
+        return 0;
+    }
+
+    // The bucket is one more than the index of the highest differing bit
+#ifdef _MSC_VER
+    unsigned long highestBit;
+    _BitScanReverse(&highestBit, cost ^ lastCost);
+    return static_cast<int>(highestBit) + 1;
+#else
+    return 32 - __builtin_clz(cost ^ lastCost);
+#endif
+}
+
+inline void RadixHeap::insert(int value, int cost)
+{
+    buckets[getBucket(cost)].push_back({ static_cast<unsigned int>(cost), value });
+    nodesCount++;
+}
+
+inline int RadixHeap::extractMinimum()
+{
+    if (buckets[0].empty())
+    {
+        redistribute();
+    }
+
+    int value = buckets[0].back().value;
+    buckets[0].pop_back();
+    nodesCount--;
+
+    return value;
+}
+
+inline int RadixHeap::getLastExtractedCost() const
+{
+    return static_cast<int>(lastCost);
+}
+
+#endif // RADIXHEAP_H
@@ -0,0 +1,231 @@
+#include "RelaxationKernel.h"
+#include <climits>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define RELAXATION_KERNEL_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang compile single functions for an instruction set, MSVC allows the intrinsics anywhere
+#if defined(RELAXATION_KERNEL_X86) && !defined(_MSC_VER)
+#define RELAXATION_KERNEL_TARGET(instructionSet) __attribute__((target(instructionSet)))
+#else
+#define RELAXATION_KERNEL_TARGET(instructionSet)
+#endif
+
+RelaxationKernel::InstructionSet RelaxationKernel::getInstructionSet()
+{
+    return getSelectedInstructionSet().load(std::memory_order_relaxed);
+}
+
+void RelaxationKernel::setInstructionSet(InstructionSet instructionSet)
+{
+    static const InstructionSet supported = detectInstructionSet();
+    if (static_cast<int>(instructionSet) > static_cast<int>(supported))
+    {
+        instructionSet = supported;
+    }
+
+    getSelectedInstructionSet().store(instructionSet);
+}
+
+int RelaxationKernel::relax(const int* targets, const int* weights, int edgeCount, int node, int nodeCost,
+                            unsigned int* stamps, unsigned int currentStamp, int* costs, int* previous, int* relaxed)
+{
+    // Short runs do not fill a vector, so the scalar kernel is faster for them
+    if (edgeCount >= VECTOR_MINIMUM_EDGE_COUNT)
+    {
+        InstructionSet instructionSet = getSelectedInstructionSet().load(std::memory_order_relaxed);
+        if (instructionSet == InstructionSet::Avx512)
+        {
+            return relaxAvx512(targets, weights, edgeCount, node, nodeCost, stamps, currentStamp, costs, previous, relaxed);
+        }
+        else if (instructionSet == InstructionSet::Avx2)
+        {
+            return relaxAvx2(targets, weights, edgeCount, node, nodeCost, stamps, currentStamp, costs, previous, relaxed);
+        }
+    }
+
+    return relaxScalar(targets, weights, edgeCount, node, nodeCost, stamps, currentStamp, costs, previous, relaxed);
+}
+
+std::atomic<RelaxationKernel::InstructionSet>& RelaxationKernel::getSelectedInstructionSet()
+{
+    // Detected on first use, which is thread safe for a local static
+    static std::atomic<InstructionSet> selected(detectInstructionSet());
+    return selected;
+}
+
+int RelaxationKernel::relaxScalar(const int* targets, const int* weights, int edgeCount, int node, int nodeCost,
+                                  unsigned int* stamps, unsigned int currentStamp, int* costs, int* previous, int* relaxed)
+{
+    int relaxedCount = 0;
+
+    for (int i = 0; i < edgeCount; i++)
+    {
+        int target = targets[i];
+        int newCost = weights[i] + nodeCost;
+        int cost = stamps[target] == currentStamp ? costs[target] : INT_MAX;
+
+        if (newCost < cost)
+        {
+            stamps[target] = currentStamp;
+            costs[target] = newCost;
+            previous[target] = node;
+            relaxed[relaxedCount++] = target;
+        }
+    }
+
+    return relaxedCount;
+}
+
+#ifdef RELAXATION_KERNEL_X86
+
+RELAXATION_KERNEL_TARGET("avx2")
+int RelaxationKernel::relaxAvx2(const int* targets, const int* weights, int edgeCount, int node, int nodeCost,
+                                unsigned int* stamps, unsigned int currentStamp, int* costs, int* previous, int* relaxed)
+{
+    const __m256i nodeCosts = _mm256_set1_epi32(nodeCost);
+    const __m256i currentStamps = _mm256_set1_epi32(static_cast<int>(currentStamp));
+    const __m256i unreachedCosts = _mm256_set1_epi32(INT_MAX);
+
+    int relaxedCount = 0;
+    int i = 0;
+    for (; i + 8 <= edgeCount; i += 8)
+    {
+        __m256i targetValues = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(targets + i));
+        __m256i newCosts = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + i)), nodeCosts);
+
+        // Entries with an old stamp belong to an earlier query and count as unreached
+        __m256i stampValues = _mm256_i32gather_epi32(reinterpret_cast<const int*>(stamps), targetValues, 4);
+        __m256i isValid = _mm256_cmpeq_epi32(stampValues, currentStamps);
+        __m256i costValues = _mm256_mask_i32gather_epi32(unreachedCosts, costs, targetValues, isValid, 4);
+
+        // AVX2 can not scatter, so the few lanes, which improve, are written one by one
+        unsigned int mask = static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(costValues, newCosts))));
+        while (mask != 0)
+        {
+#ifdef _MSC_VER
+            unsigned long lane;
+            _BitScanForward(&lane, mask);
+#else
+            int lane = __builtin_ctz(mask);
+#endif
+            int target = targets[i + lane];
+            stamps[target] = currentStamp;
+            costs[target] = weights[i + lane] + nodeCost;
+            previous[target] = node;
+            relaxed[relaxedCount++] = target;
+            mask &= mask - 1;
+        }
+    }
+
+    return relaxedCount + relaxScalar(targets + i, weights + i, edgeCount - i, node, nodeCost, stamps, currentStamp, costs, previous, relaxed + relaxedCount);
+}
+
+RELAXATION_KERNEL_TARGET("avx512f")
+int RelaxationKernel::relaxAvx512(const int* targets, const int* weights, int edgeCount, int node, int nodeCost,
+                                  unsigned int* stamps, unsigned int currentStamp, int* costs, int* previous, int* relaxed)
+{
+    const __m512i nodeCosts = _mm512_set1_epi32(nodeCost);
+    const __m512i currentStamps = _mm512_set1_epi32(static_cast<int>(currentStamp));
+    const __m512i unreachedCosts = _mm512_set1_epi32(INT_MAX);
+
+    int relaxedCount = 0;
+    int i = 0;
+    for (; i + 16 <= edgeCount; i += 16)
+    {
+        __m512i targetValues = _mm512_loadu_si512(targets + i);
+        __m512i newCosts = _mm512_add_epi32(_mm512_loadu_si512(weights + i), nodeCosts);
+
+        // Entries with an old stamp belong to an earlier query and count as unreached
+        __m512i stampValues = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, targetValues, stamps, 4);
+        __mmask16 isValid = _mm512_cmpeq_epi32_mask(stampValues, currentStamps);
+        __m512i costValues = _mm512_mask_i32gather_epi32(unreachedCosts, isValid, targetValues, costs, 4);
+
+        // Few lanes improve once the search has progressed, so they are written one by one, which is faster than masked scatters
+        unsigned int mask = _mm512_cmplt_epi32_mask(newCosts, costValues);
+        while (mask != 0)
+        {
+#ifdef _MSC_VER
+            unsigned long lane;
+            _BitScanForward(&lane, mask);
+#else
+            int lane = __builtin_ctz(mask);
+#endif
+            int target = targets[i + lane];
+            stamps[target] = currentStamp;
+            costs[target] = weights[i + lane] + nodeCost;
+            previous[target] = node;
+            relaxed[relaxedCount++] = target;
+            mask &= mask - 1;
+        }
+    }
+
+    return relaxedCount + relaxScalar(targets + i, weights + i, edgeCount - i, node, nodeCost, stamps, currentStamp, costs, previous, relaxed + relaxedCount);
+}
+
+RelaxationKernel::InstructionSet RelaxationKernel::detectInstructionSet()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return InstructionSet::Scalar;
+    }
+
+    // The operating system has to save the vector registers, which XGETBV reports when OSXSAVE is set
+    __cpuid(info, 1);
+    bool hasOsSupport = (info[2] & (1 << 27)) != 0;
+    unsigned long long enabledStates = hasOsSupport ? _xgetbv(0) : 0;
+
+    __cpuidex(info, 7, 0);
+    if ((info[1] & (1 << 16)) != 0 && (enabledStates & 0xE6) == 0xE6)
+    {
+        return InstructionSet::Avx512;
+    }
+
+    if ((info[1] & (1 << 5)) != 0 && (enabledStates & 0x6) == 0x6)
+    {
+        return InstructionSet::Avx2;
+    }
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return InstructionSet::Avx512;
+    }
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return InstructionSet::Avx2;
+    }
+#endif
+
+    return InstructionSet::Scalar;
+}
+
+#else
+
+int RelaxationKernel::relaxAvx2(const int* targets, const int* weights, int edgeCount, int node, int nodeCost,
+                                unsigned int* stamps, unsigned int currentStamp, int* costs, int* previous, int* relaxed)
+{
+    return relaxScalar(targets, weights, edgeCount, node, nodeCost, stamps, currentStamp, costs, previous, relaxed);
+}
+
+int RelaxationKernel::relaxAvx512(const int* targets, const int* weights, int edgeCount, int node, int nodeCost,
+                                  unsigned int* stamps, unsigned int currentStamp, int* costs, int* previous, int* relaxed)
+{
+    return relaxScalar(targets, weights, edgeCount, node, nodeCost, stamps, currentStamp, costs, previous, relaxed);
+}
+
+RelaxationKernel::InstructionSet RelaxationKernel::detectInstructionSet()
+{
+    return InstructionSet::Scalar;
+}
+
+#endif
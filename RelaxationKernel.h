@@ -0,0 +1,81 @@
+#ifndef RELAXATIONKERNEL_H
+#define RELAXATIONKERNEL_H
+
+#include <atomic>
+
+/*!
+ * Represents the relaxation of a run of contiguous edges leaving a settled node, vectorized with the widest instruction set the CPU supports.
+ * The targets' costs are gathered, compared with the costs through the settled node and the lower ones are written back,
+ * eight (AVX2) or sixteen (AVX-512) edges at a time. The instruction set is detected once at runtime, so the build does not need any target flags.
+ * The targets of a run must be distinct, which the graph guarantees, as it rejects duplicate edges.
+ */
+class RelaxationKernel
+{
+public:
+    /*!
+     * Represents the instruction sets, which the kernel can use.
+     */
+    enum class InstructionSet
+    {
+        Scalar,
+        Avx2,
+        Avx512
+    };
+
+    /*!
+     * Gets the instruction set used by relax.
+     * \return The instruction set.
+     */
+    static InstructionSet getInstructionSet();
+    /*!
+     * Sets the instruction set used by relax, which is limited to the ones the CPU supports. Meant for benchmarks.
+     * \param instructionSet The instruction set.
+     */
+    static void setInstructionSet(InstructionSet instructionSet);
+
+    /*!
+     * Relaxes the edges of a node, whose entries of the cost arrays are stamped like the ones of ShortestPathWorkspace.
+     * \param targets The destinations of the edges.
+     * \param weights The weights of the edges.
+     * \param edgeCount The count of edges.
+     * \param node The node, which the edges leave.
+     * \param nodeCost The cost of the node.
+     * \param stamps The stamps of the cost entries, an entry is only valid with the current stamp.
+     * \param currentStamp The current stamp.
+     * \param costs The costs of the nodes.
+     * \param previous The previous nodes on the nodes' paths.
+     * \param relaxed Filled with the targets, whose cost decreased, in edge order. Needs room for edgeCount entries.
+     * \return The count of targets, whose cost decreased.
+     */
+    static int relax(const int* targets, const int* weights, int edgeCount, int node, int nodeCost,
+                     unsigned int* stamps, unsigned int currentStamp, int* costs, int* previous, int* relaxed);
+
+private:
+    /*!
+     * The count of edges, below which the vectorized kernels fall back to the scalar one.
+     */
+    static const int VECTOR_MINIMUM_EDGE_COUNT = 8;
+
+    /*!
+     * The kernels, all taking the parameters of relax.
+     */
+    static int relaxScalar(const int* targets, const int* weights, int edgeCount, int node, int nodeCost,
+                           unsigned int* stamps, unsigned int currentStamp, int* costs, int* previous, int* relaxed);
+    static int relaxAvx2(const int* targets, const int* weights, int edgeCount, int node, int nodeCost,
+                         unsigned int* stamps, unsigned int currentStamp, int* costs, int* previous, int* relaxed);
+    static int relaxAvx512(const int* targets, const int* weights, int edgeCount, int node, int nodeCost,
+                           unsigned int* stamps, unsigned int currentStamp, int* costs, int* previous, int* relaxed);
+
+    /*!
+     * Gets the instruction set used by relax, which is the detected one unless setInstructionSet changed it.
+     * \return The selected instruction set.
+     */
+    static std::atomic<InstructionSet>& getSelectedInstructionSet();
+    /*!
+     * Detects the widest instruction set supported by the CPU and the operating system.
+     * \return The instruction set.
+     */
+    static InstructionSet detectInstructionSet();
+};
+
+#endif // RELAXATIONKERNEL_H
@@ -0,0 +1,24 @@
+#ifndef SHORTESTPATHENGINE_H
+#define SHORTESTPATHENGINE_H
+
+#include <vector>
+
+/*!
+ * Represents a point-to-point shortest path query engine over a graph, which can stand in for Graph::calculateShortestPath.
+ */
+class ShortestPathEngine
+{
+public:
+    virtual ~ShortestPathEngine() {}
+
+    /*!
+     * Calculates the shortest path between source and destination nodes.
+     * \param source The source node.
+     * \param destination The destination node.
+     * \param nodes Filled with the nodes of the shortest path from source to destination, empty if there is no path.
+     * \return The cost of the shortest path, INT_MAX if there is no path.
+     */
+    virtual int findShortestPath(int source, int destination, std::vector<int>& nodes) = 0;
+};
+
+#endif // SHORTESTPATHENGINE_H
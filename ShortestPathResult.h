@@ -0,0 +1,27 @@
+#ifndef SHORTESTPATHRESULT_H
+#define SHORTESTPATHRESULT_H
+
+#include <climits>
+#include <vector>
+
+/*!
+ * Represents the shortest path between two nodes, as calculated by Graph::calculateShortestPath.
+ * A result can be passed to many queries, its node buffer keeps its memory and is only refilled.
+ */
+struct ShortestPathResult
+{
+    /*!
+     * The cost of the path, INT_MAX if the destination is not reachable.
+     */
+    int cost = INT_MAX;
+    /*!
+     * Whether there is a path from the source to the destination.
+     */
+    bool reachable = false;
+    /*!
+     * The nodes of the path from the source to the destination, empty if the destination is not reachable.
+     */
+    std::vector<int> nodes;
+};
+
+#endif // SHORTESTPATHRESULT_H
@@ -0,0 +1,132 @@
+#include "ShortestPathTreeCache.h"
+#include "DijkstraInputException.h"
+#include <algorithm>
+
+ShortestPathTreeCache::ShortestPathTreeCache(const Graph& graph, size_t memoryBudget)
+    : graph(graph)
+{
+    this->memoryBudget = memoryBudget;
+    this->graphVersion = graph.getVersion();
+    this->hitCount = 0;
+    this->missCount = 0;
+}
+
+int ShortestPathTreeCache::findShortestPath(int source, int destination, std::vector<int>& nodes)
+{
+    if (!graph.doesNodeExist(source))
+    {
+        throw DijkstraInputException("Source does not exist in the graph.");
+    }
+
+    if (!graph.doesNodeExist(destination))
+    {
+        throw DijkstraInputException("Destination does not exist in the graph.");
+    }
+
+    const Tree& tree = getTree(source);
+
+    nodes.clear();
+    int cost = tree.costs[destination];
+    if (cost == INT_MAX)
+    {
+        return INT_MAX;
+    }
+
+    for (int node = destination; node != -1; node = tree.path[node])
+    {
+        nodes.push_back(node);
+    }
+
+    std::reverse(nodes.begin(), nodes.end());
+    return cost;
+}
+
+size_t ShortestPathTreeCache::getMemoryBudget() const
+{
+    return memoryBudget;
+}
+
+void ShortestPathTreeCache::setMemoryBudget(size_t memoryBudget)
+{
+    this->memoryBudget = memoryBudget;
+    evict(trees.size());
+}
+
+void ShortestPathTreeCache::clear()
+{
+    trees.clear();
+    positions.clear();
+}
+
+int ShortestPathTreeCache::getTreeCount() const
+{
+    return static_cast<int>(trees.size());
+}
+
+long long ShortestPathTreeCache::getHitCount() const
+{
+    return hitCount;
+}
+
+long long ShortestPathTreeCache::getMissCount() const
+{
+    return missCount;
+}
+
+size_t ShortestPathTreeCache::getTreeSize() const
+{
+    return 2 * static_cast<size_t>(graph.getCurrentNodeCount()) * sizeof(int);
+}
+
+void ShortestPathTreeCache::evict(size_t treeCount)
+{
+    while (!trees.empty() && treeCount * getTreeSize() > memoryBudget)
+    {
+        positions.erase(trees.back().source);
+        trees.pop_back();
+        treeCount--;
+    }
+}
+
+const ShortestPathTreeCache::Tree& ShortestPathTreeCache::getTree(int source)
+{
+    // The trees do not know about edges added or reweighted after they were calculated
+    if (graph.getVersion() != graphVersion)
+    {
+        clear();
+        graphVersion = graph.getVersion();
+    }
+
+    auto position = positions.find(source);
+    if (position != positions.end())
+    {
+        hitCount++;
+        trees.splice(trees.begin(), trees, position->second);
+        return trees.front();
+    }
+
+    missCount++;
+    if (getTreeSize() > memoryBudget)
+    {
+        uncachedTree.source = source;
+        graph.calculateShortestPathTree(source, uncachedTree.costs, uncachedTree.path);
+        return uncachedTree;
+    }
+
+    // Reuse the memory of the least recently used tree, if it has to be dropped for the new one
+    if (!trees.empty() && (trees.size() + 1) * getTreeSize() > memoryBudget)
+    {
+        positions.erase(trees.back().source);
+        trees.splice(trees.begin(), trees, std::prev(trees.end()));
+    }
+    else
+    {
+        trees.emplace_front();
+    }
+
+    Tree& tree = trees.front();
+    tree.source = source;
+    graph.calculateShortestPathTree(source, tree.costs, tree.path);
+    positions[source] = trees.begin();
+    return tree;
+}
@@ -0,0 +1,119 @@
+#ifndef SHORTESTPATHTREECACHE_H
+#define SHORTESTPATHTREECACHE_H
+
+#include "Graph.h"
+#include "ShortestPathEngine.h"
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+/*!
+ * Represents a point-to-point shortest path engine, which keeps the complete shortest path trees of the recently queried sources.
+ * A query from a cached source only walks the path back from the destination, the least recently used trees are dropped to stay within the memory budget.
+ * All trees are dropped once the graph's version shows, that the graph has been changed since they were calculated.
+ */
+class ShortestPathTreeCache : public ShortestPathEngine
+{
+public:
+    /*!
+     * Constructor, creates an empty cache for the specified graph.
+     * \param graph The graph to be searched, which must outlive the cache.
+     * \param memoryBudget The memory, which the trees may use, in bytes.
+     */
+    ShortestPathTreeCache(const Graph& graph, size_t memoryBudget = DEFAULT_MEMORY_BUDGET);
+
+    /*!
+     * Calculates the shortest path between source and destination nodes, calculating the source's tree if it is not cached.
+     * \param source The source node.
+     * \param destination The destination node.
+     * \param nodes Filled with the nodes of the shortest path from source to destination, empty if there is no path.
+     * \return The cost of the shortest path, INT_MAX if there is no path.
+     */
+    int findShortestPath(int source, int destination, std::vector<int>& nodes) override;
+
+    /*!
+     * Gets the memory budget.
+     * \return The memory, which the trees may use, in bytes.
+     */
+    size_t getMemoryBudget() const;
+    /*!
+     * Sets the memory budget, dropping the least recently used trees, which do not fit anymore.
+     * \param memoryBudget The memory, which the trees may use, in bytes.
+     */
+    void setMemoryBudget(size_t memoryBudget);
+    /*!
+     * Drops all trees.
+     */
+    void clear();
+
+    /*!
+     * Gets the count of cached trees.
+     * \return The tree count.
+     */
+    int getTreeCount() const;
+    /*!
+     * Gets the count of queries, which were answered from a cached tree.
+     * \return The hit count.
+     */
+    long long getHitCount() const;
+    /*!
+     * Gets the count of queries, which had to calculate a tree.
+     * \return The miss count.
+     */
+    long long getMissCount() const;
+
+private:
+    /*!
+     * The memory budget of a default cache, 64 MB.
+     */
+    static const size_t DEFAULT_MEMORY_BUDGET = 64 << 20;
+
+    /*!
+     * Represents the shortest path tree of a source.
+     */
+    struct Tree
+    {
+        int source;
+        std::vector<int> costs;
+        std::vector<int> path;
+    };
+
+    const Graph& graph;
+    size_t memoryBudget;
+    /*!
+     * The graph's version, which the cached trees were calculated for.
+     */
+    unsigned long long graphVersion;
+    long long hitCount;
+    long long missCount;
+
+    /*!
+     * The trees ordered from the most to the least recently used one and the position of every cached source's tree.
+     */
+    std::list<Tree> trees;
+    std::unordered_map<int, std::list<Tree>::iterator> positions;
+    /*!
+     * The tree of a query, which does not fit the budget.
+     */
+    Tree uncachedTree;
+
+    /*!
+     * Gets the memory of a tree of the graph.
+     * \return The tree's size in bytes.
+     */
+    size_t getTreeSize() const;
+    /*!
+     * Drops the least recently used trees, until the specified count of trees fits the budget.
+     * \param treeCount The count of trees.
+     */
+    void evict(size_t treeCount);
+    /*!
+     * Gets the tree of a source, calculating it if it is not cached.
+     * \param source The source node.
+     * \return The tree.
+     */
+    const Tree& getTree(int source);
+};
+
+#endif // SHORTESTPATHTREECACHE_H
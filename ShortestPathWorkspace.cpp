@@ -0,0 +1,52 @@
+#include "ShortestPathWorkspace.h"
+
+ShortestPathWorkspace::ShortestPathWorkspace()
+    : heap(0), bucketQueue(0)
+{
+    this->currentStamp = 0;
+    this->bucketsEdgeWeight = 0;
+}
+
+void ShortestPathWorkspace::prepare(int nodeCount)
+{
+    // Grow the arrays if the graph has more nodes than any graph searched before
+    if (static_cast<int>(stamps.size()) < nodeCount)
+    {
+        costs.resize(nodeCount);
+        previous.resize(nodeCount);
+        stamps.assign(nodeCount, 0);
+        targetStamps.assign(nodeCount, 0);
+        currentStamp = 0;
+        heap = IndexedDaryHeap<int, 4>(nodeCount);
+    }
+    else
+    {
+        heap.clear();
+    }
+
+    radixHeap.clear();
+
+    // A new stamp invalidates all entries at once, the array is only reset when the stamps wrap around
+    currentStamp++;
+    if (currentStamp == 0)
+    {
+        stamps.assign(stamps.size(), 0);
+        targetStamps.assign(targetStamps.size(), 0);
+        currentStamp = 1;
+    }
+}
+
+DialBucketQueue& ShortestPathWorkspace::getBucketQueue(int maximumEdgeWeight)
+{
+    if (bucketsEdgeWeight != maximumEdgeWeight)
+    {
+        bucketQueue = DialBucketQueue(maximumEdgeWeight);
+        bucketsEdgeWeight = maximumEdgeWeight;
+    }
+    else
+    {
+        bucketQueue.clear();
+    }
+
+    return bucketQueue;
+}
@@ -0,0 +1,192 @@
+#ifndef SHORTESTPATHWORKSPACE_H
+#define SHORTESTPATHWORKSPACE_H
+
+#include "IndexedDaryHeap.h"
+#include "DialBucketQueue.h"
+#include "RadixHeap.h"
+#include "RelaxationKernel.h"
+#include "CompressedCsrGraph.h"
+#include <climits>
+#include <vector>
+
+/*!
+ * Represents the memory used by shortest path queries, which is kept across queries.
+ * Every entry of the cost and path arrays is stamped with the query that wrote it,
+ * so starting a new query does not have to reset the arrays and costs only what the previous query touched.
+ */
+class ShortestPathWorkspace
+{
+public:
+    /*!
+     * Default constructor, creates an empty workspace, which grows on the first query.
+     */
+    ShortestPathWorkspace();
+
+    /*!
+     * Starts a new query, after which all nodes are unreached and the heaps are empty.
+     * \param nodeCount The node count of the searched graph.
+     */
+    void prepare(int nodeCount);
+
+    /*!
+     * Gets the cost of the shortest known path to a node in the current query.
+     * \param node The node.
+     * \return The node's cost, INT_MAX if the node has not been reached.
+     */
+    int getCost(int node) const;
+    /*!
+     * Gets the previous node on the shortest known path to a node in the current query.
+     * \param node The node.
+     * \return The previous node, -1 if the node has not been reached or is the source.
+     */
+    int getPrevious(int node) const;
+    /*!
+     * Sets the cost of the shortest known path to a node and the previous node on it.
+     * \param node The node.
+     * \param cost The node's cost.
+     * \param previous The previous node, -1 for the source.
+     */
+    void setCost(int node, int cost, int previous);
+
+    /*!
+     * Relaxes the edges leaving a node, setting the cost and previous node of every target, which the edges reach cheaper.
+     * The edges are processed by RelaxationKernel, so their targets must be distinct.
+     * \param targets The destinations of the edges.
+     * \param weights The weights of the edges.
+     * \param edgeCount The count of edges.
+     * \param node The node, which the edges leave.
+     * \param nodeCost The cost of the node.
+     * \return The count of targets, whose cost decreased, which getRelaxedNode returns in edge order.
+     */
+    int relaxEdges(const int* targets, const int* weights, int edgeCount, int node, int nodeCost);
+    /*!
+     * Gets a target, whose cost decreased in the last call of relaxEdges.
+     * \param index The target's index, less than the count returned by relaxEdges.
+     * \return The target.
+     */
+    int getRelaxedNode(int index) const;
+
+    /*!
+     * Decodes the edges leaving a node of a compressed adjacency into the workspace.
+     * \param adjacency The compressed adjacency.
+     * \param node The node.
+     * \param targets Set to the destinations of the edges, which stay valid until the next call.
+     * \param weights Set to the weights of the edges, which stay valid until the next call.
+     * \return The count of edges.
+     */
+    int decodeEdges(const CompressedCsrGraph& adjacency, int node, const int*& targets, const int*& weights);
+
+    /*!
+     * Marks a node as a target of the current query.
+     * \param node The node.
+     * \return Whether the node was not marked before.
+     */
+    bool markTarget(int node);
+    /*!
+     * Returns whether a node has been marked as a target of the current query.
+     * \param node The node.
+     * \return Whether the node is a target.
+     */
+    bool isTarget(int node) const;
+
+    /*!
+     * Gets the indexed d-ary heap, emptied by prepare.
+     * \return The heap.
+     */
+    IndexedDaryHeap<int, 4>& getHeap();
+    /*!
+     * Gets an empty Dial's bucket queue. The buckets are only reallocated if the maximum edge weight changes.
+     * \param maximumEdgeWeight The maximum edge weight of the searched graph.
+     * \return The bucket queue.
+     */
+    DialBucketQueue& getBucketQueue(int maximumEdgeWeight);
+    /*!
+     * Gets the radix heap, emptied by prepare.
+     * \return The radix heap.
+     */
+    RadixHeap& getRadixHeap();
+
+private:
+    std::vector<int> costs;
+    std::vector<int> previous;
+    std::vector<unsigned int> stamps;
+    std::vector<unsigned int> targetStamps;
+    std::vector<int> relaxedNodes;
+    std::vector<int> decodedTargets;
+    std::vector<int> decodedWeights;
+    unsigned int currentStamp;
+    int bucketsEdgeWeight;
+
+    IndexedDaryHeap<int, 4> heap;
+    DialBucketQueue bucketQueue;
+    RadixHeap radixHeap;
+};
+
+inline int ShortestPathWorkspace::getCost(int node) const
+{
+    return stamps[node] == currentStamp ? costs[node] : INT_MAX;
+}
+
+inline int ShortestPathWorkspace::getPrevious(int node) const
+{
+    return stamps[node] == currentStamp ? previous[node] : -1;
+}
+
+inline void ShortestPathWorkspace::setCost(int node, int cost, int previous)
+{
+    stamps[node] = currentStamp;
+    this->costs[node] = cost;
+    this->previous[node] = previous;
+}
+
+inline int ShortestPathWorkspace::relaxEdges(const int* targets, const int* weights, int edgeCount, int node, int nodeCost)
+{
+    if (static_cast<int>(relaxedNodes.size()) < edgeCount)
+    {
+        relaxedNodes.resize(edgeCount);
+    }
+
+    return RelaxationKernel::relax(targets, weights, edgeCount, node, nodeCost, stamps.data(), currentStamp, costs.data(), previous.data(), relaxedNodes.data());
+}
+
+inline int ShortestPathWorkspace::getRelaxedNode(int index) const
+{
+    return relaxedNodes[index];
+}
+
+inline int ShortestPathWorkspace::decodeEdges(const CompressedCsrGraph& adjacency, int node, const int*& targets, const int*& weights)
+{
+    if (static_cast<int>(decodedTargets.size()) < adjacency.getMaximumDegree())
+    {
+        decodedTargets.resize(adjacency.getMaximumDegree());
+        decodedWeights.resize(adjacency.getMaximumDegree());
+    }
+
+    targets = decodedTargets.data();
+    weights = decodedWeights.data();
+    return adjacency.decodeEdges(node, decodedTargets.data(), decodedWeights.data());
+}
+
+inline bool ShortestPathWorkspace::markTarget(int node)
+{
+    bool isNew = targetStamps[node] != currentStamp;
+    targetStamps[node] = currentStamp;
+    return isNew;
+}
+
+inline bool ShortestPathWorkspace::isTarget(int node) const
+{
+    return targetStamps[node] == currentStamp;
+}
+
+inline IndexedDaryHeap<int, 4>& ShortestPathWorkspace::getHeap()
+{
+    return heap;
+}
+
+inline RadixHeap& ShortestPathWorkspace::getRadixHeap()
+{
+    return radixHeap;
+}
+
+#endif // SHORTESTPATHWORKSPACE_H
@@ -0,0 +1,350 @@
+#include "TextGraphParser.h"
+#include "DijkstraException.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <thread>
+
+TextGraphParser::TextGraphParser(int threadCount)
+{
+    this->threadCount = threadCount > 0 ? threadCount : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    this->nodeCount = 0;
+    this->edgeCount = 0;
+}
+
+void TextGraphParser::setProgressCallback(std::function<bool(long long, long long)> progressCallback)
+{
+    this->progressCallback = progressCallback;
+}
+
+bool TextGraphParser::parseFile(QFile& file)
+{
+    qint64 size = file.size();
+    if (size == 0)
+    {
+        return parse(nullptr, nullptr);
+    }
+
+    // Mapping avoids copying the text, files, which can not be mapped, are read in one piece
+    uchar* data = file.map(0, size);
+    if (data != nullptr)
+    {
+        const char* text = reinterpret_cast<const char*>(data);
+        return parse(text, text + size);
+    }
+
+    std::vector<char> buffer(static_cast<size_t>(size));
+    if (file.read(buffer.data(), size) != size)
+    {
+        throw DijkstraException("Could not read graph file.");
+    }
+
+    return parse(buffer.data(), buffer.data() + buffer.size());
+}
+
+bool TextGraphParser::parse(const char* begin, const char* end)
+{
+    edges.clear();
+
+    // The first line holds the node and the edge count, empty fields are skipped like QString::split with Qt::SkipEmptyParts does
+    const char* firstLineEnd = findLineEnd(begin, end);
+    const char* firstContentEnd = firstLineEnd > begin && firstLineEnd[-1] == '\r' ? firstLineEnd - 1 : firstLineEnd;
+    int counts[2];
+    int countCount = 0;
+    const char* field = begin;
+    while (true)
+    {
+        const char* fieldEnd = std::find(field, firstContentEnd, ',');
+        if (fieldEnd != field)
+        {
+            int value;
+            if (countCount == 2 || parseNumber(field, fieldEnd, value) != fieldEnd)
+            {
+                throw DijkstraException("File couldn't be parsed! First line is malformed.");
+            }
+
+            counts[countCount++] = value;
+        }
+
+        if (fieldEnd == firstContentEnd)
+        {
+            break;
+        }
+
+        field = fieldEnd + 1;
+    }
+
+    if (countCount != 2 || counts[0] < 0 || counts[1] < 0)
+    {
+        throw DijkstraException("File couldn't be parsed! First line is malformed.");
+    }
+
+    nodeCount = counts[0];
+    edgeCount = counts[1];
+
+    const char* bodyBegin = firstLineEnd == end ? end : firstLineEnd + 1;
+    size_t bodySize = static_cast<size_t>(end - bodyBegin);
+    int chunkCount = static_cast<int>(std::min<size_t>(threadCount, bodySize / PARALLEL_CHUNK_SIZE));
+
+    if (chunkCount <= 1)
+    {
+        edges.reserve(estimateEdgeCapacity(bodySize, edgeCount));
+        long long parsedBytes = bodyBegin - begin;
+        long long parsedEdgeCount = 0;
+        const char* malformedLine = nullptr;
+        bool isComplete = parseEdgeBlocks(bodyBegin, end, edges, [&](long long blockSize, long long blockEdgeCount)
+        {
+            parsedBytes += blockSize;
+            parsedEdgeCount += blockEdgeCount;
+            return !progressCallback || progressCallback(parsedBytes, parsedEdgeCount);
+        }, malformedLine);
+
+        if (malformedLine != nullptr)
+        {
+            throwMalformedLine(begin, malformedLine);
+        }
+
+        if (!isComplete)
+        {
+            edges.clear();
+        }
+
+        return isComplete;
+    }
+
+    // Split the lines into chunks of about the same size, every chunk ends after a line feed
+    std::vector<const char*> chunkBegins(chunkCount + 1, end);
+    chunkBegins[0] = bodyBegin;
+    for (int i = 1; i < chunkCount; i++)
+    {
+        const char* lineEnd = findLineEnd(std::max(chunkBegins[i - 1], bodyBegin + bodySize / chunkCount * i), end);
+        chunkBegins[i] = lineEnd == end ? end : lineEnd + 1;
+    }
+
+    std::vector<std::vector<Edge>> chunkEdges(chunkCount);
+    std::vector<const char*> malformedLines(chunkCount, nullptr);
+    std::vector<std::exception_ptr> exceptions(chunkCount);
+    std::atomic<long long> parsedBytes(bodyBegin - begin);
+    std::atomic<long long> parsedEdgeCount(0);
+    std::atomic<int> runningCount(chunkCount);
+    std::atomic<bool> isCancelled(false);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < chunkCount; i++)
+    {
+        threads.emplace_back([&, i]()
+        {
+            try
+            {
+                chunkEdges[i].reserve(estimateEdgeCapacity(static_cast<size_t>(chunkBegins[i + 1] - chunkBegins[i]), edgeCount / chunkCount));
+                parseEdgeBlocks(chunkBegins[i], chunkBegins[i + 1], chunkEdges[i], [&](long long blockSize, long long blockEdgeCount)
+                {
+                    parsedBytes += blockSize;
+                    parsedEdgeCount += blockEdgeCount;
+                    return !isCancelled.load(std::memory_order_relaxed);
+                }, malformedLines[i]);
+            }
+            catch (...)
+            {
+                exceptions[i] = std::current_exception();
+            }
+
+            runningCount--;
+        });
+    }
+
+    // The callback is only called on this thread, which reports the progress of all threads until they are done
+    if (progressCallback)
+    {
+        while (runningCount.load() > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(PROGRESS_INTERVAL_MS));
+            if (!progressCallback(parsedBytes.load(), parsedEdgeCount.load()))
+            {
+                isCancelled = true;
+            }
+        }
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (isCancelled)
+    {
+        return false;
+    }
+
+    // Report the first malformed line of the text, which lies in the first chunk with one
+    for (int i = 0; i < chunkCount; i++)
+    {
+        if (exceptions[i])
+        {
+            std::rethrow_exception(exceptions[i]);
+        }
+
+        if (malformedLines[i] != nullptr)
+        {
+            throwMalformedLine(begin, malformedLines[i]);
+        }
+    }
+
+    size_t totalEdgeCount = 0;
+    for (const std::vector<Edge>& lineEdges : chunkEdges)
+    {
+        totalEdgeCount += lineEdges.size();
+    }
+
+    edges.reserve(totalEdgeCount);
+    for (const std::vector<Edge>& lineEdges : chunkEdges)
+    {
+        edges.insert(edges.end(), lineEdges.begin(), lineEdges.end());
+    }
+
+    return true;
+}
+
+int TextGraphParser::getNodeCount() const
+{
+    return nodeCount;
+}
+
+int TextGraphParser::getEdgeCount() const
+{
+    return edgeCount;
+}
+
+const std::vector<Edge>& TextGraphParser::getEdges() const
+{
+    return edges;
+}
+
+bool TextGraphParser::parseEdgeBlocks(const char* begin, const char* end, std::vector<Edge>& lineEdges,
+                                      const std::function<bool(long long, long long)>& onBlockParsed, const char*& malformedLine)
+{
+    malformedLine = nullptr;
+
+    const char* block = begin;
+    while (block < end)
+    {
+        // Every block ends after a line feed, so no line is split between blocks
+        const char* blockEnd = end;
+        if (static_cast<size_t>(end - block) > PROGRESS_BLOCK_SIZE)
+        {
+            const char* lineEnd = findLineEnd(block + PROGRESS_BLOCK_SIZE, end);
+            blockEnd = lineEnd == end ? end : lineEnd + 1;
+        }
+
+        size_t edgeCount = lineEdges.size();
+        malformedLine = parseEdgeLines(block, blockEnd, lineEdges);
+        if (malformedLine != nullptr)
+        {
+            return true;
+        }
+
+        if (!onBlockParsed(blockEnd - block, static_cast<long long>(lineEdges.size() - edgeCount)))
+        {
+            return false;
+        }
+
+        block = blockEnd;
+    }
+
+    return true;
+}
+
+const char* TextGraphParser::parseEdgeLines(const char* begin, const char* end, std::vector<Edge>& lineEdges)
+{
+    const char* line = begin;
+    while (line < end)
+    {
+        // Exactly three numbers, separated by commas, the whitespace around them never contains a line feed
+        int values[3];
+        const char* position = line;
+        for (int i = 0; i < 3; i++)
+        {
+            position = parseNumber(position, end, values[i]);
+            if (position == nullptr)
+            {
+                return line;
+            }
+
+            if (i < 2)
+            {
+                if (position == end || *position != ',')
+                {
+                    return line;
+                }
+
+                position++;
+            }
+        }
+
+        if (position != end && *position != '\n')
+        {
+            return line;
+        }
+
+        lineEdges.push_back(Edge(values[0], values[1], values[2]));
+        line = position == end ? end : position + 1;
+    }
+
+    return nullptr;
+}
+
+const char* TextGraphParser::parseNumber(const char* position, const char* end, int& value)
+{
+    // QString::toInt ignores surrounding whitespace and accepts a plus sign, which std::from_chars does not
+    while (position < end && (*position == ' ' || *position == '\t' || *position == '\r' || *position == '\v' || *position == '\f'))
+    {
+        position++;
+    }
+
+    if (position < end && *position == '+' && position + 1 < end && *(position + 1) >= '0' && *(position + 1) <= '9')
+    {
+        position++;
+    }
+
+    std::from_chars_result result = std::from_chars(position, end, value);
+    if (result.ec != std::errc())
+    {
+        return nullptr;
+    }
+
+    position = result.ptr;
+    while (position < end && (*position == ' ' || *position == '\t' || *position == '\r' || *position == '\v' || *position == '\f'))
+    {
+        position++;
+    }
+
+    return position;
+}
+
+const char* TextGraphParser::findLineEnd(const char* position, const char* end)
+{
+    if (position >= end)
+    {
+        return end;
+    }
+
+    const char* lineEnd = static_cast<const char*>(std::memchr(position, '\n', static_cast<size_t>(end - position)));
+    return lineEnd != nullptr ? lineEnd : end;
+}
+
+size_t TextGraphParser::estimateEdgeCapacity(size_t byteCount, long long announcedEdgeCount)
+{
+    // The last line may lack its line feed
+    return std::min(static_cast<size_t>(announcedEdgeCount), (byteCount + 1) / MINIMUM_EDGE_LINE_SIZE);
+}
+
+void TextGraphParser::throwMalformedLine(const char* begin, const char* line)
+{
+    // Lines are only counted for the error, so parsing does not keep track of them
+    long long lineNumber = 1 + std::count(begin, line, '\n');
+    std::string message = "File couldn't be parsed! Line " + std::to_string(lineNumber) + " is malformed.";
+    throw DijkstraException(message.c_str());
+}
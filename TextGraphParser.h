@@ -0,0 +1,135 @@
+#ifndef TEXTGRAPHPARSER_H
+#define TEXTGRAPHPARSER_H
+
+#include "Edge.h"
+#include <QFile>
+#include <functional>
+#include <vector>
+
+/*!
+ * Represents a parser of the text graph format, a "nodes,edges" line followed by a "source,destination,weight" line per edge.
+ * The text is parsed as raw bytes with std::from_chars instead of line by line through strings, the file is mapped if possible.
+ * Large texts are split at line ends into chunks, which are parsed in parallel.
+ * The parsing reports its progress every PROGRESS_BLOCK_SIZE bytes or PROGRESS_INTERVAL_MS milliseconds, and can be cancelled then.
+ * The numbers are read like QString::toInt reads them, so the parser accepts the same files as the line by line parsing did.
+ */
+class TextGraphParser
+{
+public:
+    /*!
+     * Constructor, creates a parser.
+     * \param threadCount The count of threads, which parse large texts, 0 for one per hardware thread.
+     */
+    TextGraphParser(int threadCount = 0);
+
+    /*!
+     * Sets the callback, which receives the progress of the parsing, on the thread calling parse.
+     * \param progressCallback Called with the count of parsed bytes and parsed edges, returns whether the parsing continues.
+     */
+    void setProgressCallback(std::function<bool(long long, long long)> progressCallback);
+
+    /*!
+     * Parses a text graph file, throws DijkstraException, naming the line, if it is malformed.
+     * \param file The file, opened for reading.
+     * \return Whether the file was parsed completely, false if the progress callback cancelled the parsing.
+     */
+    bool parseFile(QFile& file);
+    /*!
+     * Parses a text graph, throws DijkstraException, naming the line, if it is malformed.
+     * \param begin The first character of the text.
+     * \param end The character after the text's last one.
+     * \return Whether the text was parsed completely, false if the progress callback cancelled the parsing.
+     */
+    bool parse(const char* begin, const char* end);
+
+    /*!
+     * Gets the node count of the first line.
+     * \return The node count.
+     */
+    int getNodeCount() const;
+    /*!
+     * Gets the edge count of the first line, which may differ from the count of edge lines.
+     * \return The edge count.
+     */
+    int getEdgeCount() const;
+    /*!
+     * Gets the parsed edges in the order of their lines, which have not been checked against the graph yet, empty after a cancelled parsing.
+     * \return The edges.
+     */
+    const std::vector<Edge>& getEdges() const;
+
+private:
+    /*!
+     * The size of the text in bytes, which every thread parses at least.
+     */
+    static const size_t PARALLEL_CHUNK_SIZE = 1 << 22;
+    /*!
+     * The size of the text in bytes, after which a thread reports its progress.
+     */
+    static const size_t PROGRESS_BLOCK_SIZE = 1 << 22;
+    /*!
+     * The interval, in which the progress of parallel parsing is reported.
+     */
+    static const int PROGRESS_INTERVAL_MS = 50;
+    /*!
+     * The size of the shortest edge line in bytes, "0,1,2" and its line feed.
+     */
+    static const size_t MINIMUM_EDGE_LINE_SIZE = 6;
+
+    int threadCount;
+    std::function<bool(long long, long long)> progressCallback;
+    int nodeCount;
+    int edgeCount;
+    std::vector<Edge> edges;
+
+    /*!
+     * Parses edge lines in blocks of about PROGRESS_BLOCK_SIZE bytes.
+     * \param begin The first character of the first line.
+     * \param end The character after the last line.
+     * \param lineEdges Filled with the parsed edges.
+     * \param onBlockParsed Called after every block with its size and its count of edges, returns whether the parsing continues.
+     * \param malformedLine Set to the first character of the first malformed line, nullptr if all lines are well formed.
+     * \return Whether the lines were parsed completely, false if onBlockParsed cancelled the parsing.
+     */
+    static bool parseEdgeBlocks(const char* begin, const char* end, std::vector<Edge>& lineEdges,
+                                const std::function<bool(long long, long long)>& onBlockParsed, const char*& malformedLine);
+    /*!
+     * Parses edge lines.
+     * \param begin The first character of the first line.
+     * \param end The character after the last line.
+     * \param lineEdges Filled with the parsed edges.
+     * \return The first character of the first malformed line, nullptr if all lines are well formed.
+     */
+    static const char* parseEdgeLines(const char* begin, const char* end, std::vector<Edge>& lineEdges);
+    /*!
+     * Parses a number, which may be surrounded by whitespace.
+     * \param position The first character of the number's field.
+     * \param end The character after the line's last one.
+     * \param value Set to the number.
+     * \return The character after the number and its trailing whitespace, nullptr if the field does not start with a number.
+     */
+    static const char* parseNumber(const char* position, const char* end, int& value);
+    /*!
+     * Finds the end of a line.
+     * \param position A character of the line.
+     * \param end The character after the text's last one.
+     * \return The line's line feed, end for the last line without one.
+     */
+    static const char* findLineEnd(const char* position, const char* end);
+    /*!
+     * Estimates the capacity for the edges of a text, the announced count is capped by the lines the text can hold,
+     * as it comes from the file's first line.
+     * \param byteCount The size of the text.
+     * \param announcedEdgeCount The announced edge count.
+     * \return The capacity.
+     */
+    static size_t estimateEdgeCapacity(size_t byteCount, long long announcedEdgeCount);
+    /*!
+     * Throws the DijkstraException of a malformed line.
+     * \param begin The first character of the text.
+     * \param line The first character of the malformed line.
+     */
+    [[noreturn]] static void throwMalformedLine(const char* begin, const char* line);
+};
+
+#endif // TEXTGRAPHPARSER_H
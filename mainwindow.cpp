@@ -2,16 +2,26 @@
 #include "./ui_mainwindow.h"
 #include "DijkstraInputException.h"
 #include "Graph.h"
+#include "GraphFile.h"
+#include "GraphLoader.h"
 #include "QRegularExpressionValidator"
 #include "QMessageBox"
+#include <QCoreApplication>
 #include <QFileDialog>
+#include <QProgressDialog>
+#include <QStringList>
+#include <QThread>
 #include <QTimer>
+#include <algorithm>
 #include <iostream>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , ui(new Ui::MainWindow)
     , graph(nullptr)
+    , graphLoader(nullptr)
+    , loadProgressDialog(nullptr)
+    , isClosing(false)
 {
     ui->setupUi(this);
 }
@@ -161,8 +171,7 @@ void MainWindow::on_addEdgeButton_clicked()
 
     try
     {
-        Edge* edge = new Edge(source, destination, weight);
-        graph->addEdge(edge);
+        graph->addEdge(Edge(source, destination, weight));
 
         updateGraphVisualization();
 
@@ -229,10 +238,9 @@ void MainWindow::on_dijkstraButton_clicked()
         else
         {
             // Calculates the path and update label'e text
-            std::string path = graph->calculateShortestPath(source, destination, graphWidget);
-            QString text = QString::fromStdString(path);
+            ShortestPathResult path = graph->calculateShortestPath(source, destination, graphWidget);
             ui->shortestPathLabel->setWordWrap(true);
-            ui->shortestPathLabel->setText(text);
+            ui->shortestPathLabel->setText(composePathMessage(source, destination, path));
         }
     }
     catch(const DijkstraInputException& ex)
@@ -242,16 +250,48 @@ void MainWindow::on_dijkstraButton_clicked()
     }
 }
 
+QString MainWindow::composePathMessage(int source, int destination, const ShortestPathResult& path) const
+{
+    if (!path.reachable)
+    {
+        return QString("There is no path form %1 to %2").arg(source).arg(destination);
+    }
+
+    QStringList steps;
+    for (int node : path.nodes)
+    {
+        steps.append(QString::number(node));
+    }
+
+    return QString("Shortest path form %1 to %2 is %3 and its cost is %4").arg(source).arg(destination).arg(steps.join('-')).arg(path.cost);
+}
+
 void MainWindow::on_saveButton_clicked()
 {
     if (!graph)
         return;
 
-    QString filename = QFileDialog::getSaveFileName(this, "Save As", "", "Text files (*.txt");
+    QString filename = QFileDialog::getSaveFileName(this, "Save As", "", "Text files (*.txt);;Binary graph files (*.dgraph)");
 
     if (filename.isEmpty())
         return;
 
+    // Binary graph files can be mapped by the next open instead of being parsed
+    if (filename.endsWith(GraphFile::FILE_EXTENSION))
+    {
+        try
+        {
+            GraphFile::save(*graph, filename);
+        }
+        catch (const std::exception& ex)
+        {
+            QMessageBox errorMessageBox;
+            errorMessageBox.critical(this, "Error", ex.what());
+        }
+
+        return;
+    }
+
     QFile file(filename);
     if (file.open(QIODevice::WriteOnly | QIODevice::ReadWrite))
     {
@@ -260,15 +300,15 @@ void MainWindow::on_saveButton_clicked()
         // First line is always *node_count*,*edge_count
         out << nodes << "," << graph->getCurrentEdgeCount() << "\n";
         // Iterate over graph and output each edge on a separate line
+        const CsrGraph& adjacency = graph->freeze();
         for (int source = 0; source < nodes; source++)
         {
-            Node* sourceHead = graph->head[source];
-            while (sourceHead != nullptr)
+            int edgeEnd = adjacency.getEdgeEnd(source);
+            for (int edge = adjacency.getEdgeBegin(source); edge < edgeEnd; edge++)
             {
-                int destination = sourceHead->getValue();
-                int weight = sourceHead->getCost();
+                int destination = adjacency.getTarget(edge);
+                int weight = adjacency.getWeight(edge);
                 out << source << "," << destination << "," << weight << "\n";
-                sourceHead = sourceHead->getNextNode();
             }
         }
 
@@ -279,97 +319,123 @@ void MainWindow::on_saveButton_clicked()
 
 void MainWindow::on_openButton_clicked()
 {
-    QString filename= QFileDialog::getOpenFileName(this, "Choose File", "", "Text files (*.txt)");
+    QString selectedFilter;
+    QString filename= QFileDialog::getOpenFileName(this, "Choose File", "",
+                                                   "Graph files (*.txt *.dgraph);;DIMACS graphs (*.gr);;METIS graphs (*.graph *.metis);;SNAP edge lists (*.txt *.tsv)",
+                                                   &selectedFilter);
     if(filename.isEmpty())
            return;
 
-    QFile file(filename);
-    if(file.open(QIODevice::ReadOnly | QIODevice::ReadWrite))
-    {
-        try
-        {
-            QString fileContent;
-            QTextStream in(&file);
+    // SNAP edge lists can not be told apart from text graph files by their extension, the other formats are picked by it
+    GraphLoader::FileFormat format = selectedFilter.startsWith("SNAP") ? GraphLoader::FileFormat::Snap : GraphLoader::FileFormat::Automatic;
+
+    // The graph is loaded on a worker thread, the current one stays usable until the loaded one replaces it
+    QThread* loaderThread = new QThread(this);
+    graphLoader = new GraphLoader(filename, format);
+    graphLoader->moveToThread(loaderThread);
+
+    connect(loaderThread, SIGNAL(started()), graphLoader, SLOT(load()));
+    connect(graphLoader, SIGNAL(progressChanged(qint64,qint64,qint64,qint64)), this, SLOT(onGraphLoadProgressChanged(qint64,qint64,qint64,qint64)));
+    connect(graphLoader, SIGNAL(loaded(Graph*)), this, SLOT(onGraphLoaded(Graph*)));
+    connect(graphLoader, SIGNAL(failed(QString)), this, SLOT(onGraphLoadFailed(QString)));
+    connect(graphLoader, SIGNAL(finished()), this, SLOT(onGraphLoadFinished()));
+    connect(graphLoader, SIGNAL(finished()), loaderThread, SLOT(quit()));
+    connect(graphLoader, SIGNAL(finished()), graphLoader, SLOT(deleteLater()));
+    connect(loaderThread, SIGNAL(finished()), loaderThread, SLOT(deleteLater()));
+
+    loadProgressDialog = new QProgressDialog("Loading graph...", "Cancel", 0, LOAD_PROGRESS_MAXIMUM, this);
+    loadProgressDialog->setWindowModality(Qt::NonModal);
+    loadProgressDialog->setMinimumDuration(LOAD_PROGRESS_DELAY_MS);
+    loadProgressDialog->setValue(0);
+    connect(loadProgressDialog, SIGNAL(canceled()), this, SLOT(onGraphLoadCanceled()));
+
+    toggleOpenButton(false);
+    toggleSaveButton(false);
+    loaderThread->start();
+}
 
-            // Read number of nodes and edges
-            QStringList firstLineList = in.readLine().split(u',', Qt::SkipEmptyParts);
-            if (firstLineList.size() != 2)
-            {
-                throw DijkstraException("File couldn't be parsed! First line is malformed.");
-            }
+void MainWindow::onGraphLoadProgressChanged(qint64 parsedBytes, qint64 totalBytes, qint64 addedEdges, qint64 totalEdges)
+{
+    if (!loadProgressDialog)
+        return;
 
-            bool okNodes, okEdges;
-            int nodes = firstLineList[0].toInt(&okNodes);
-            int edges = firstLineList[1].toInt(&okEdges);
+    // Parsing the file and building the graph take about half of the loading each
+    double parsedShare = totalBytes > 0 ? static_cast<double>(parsedBytes) / totalBytes : 0.0;
+    double addedShare = totalEdges > 0 ? static_cast<double>(addedEdges) / totalEdges : 0.0;
+    loadProgressDialog->setValue(static_cast<int>((parsedShare + addedShare) / 2 * LOAD_PROGRESS_MAXIMUM));
 
-            // Check if conversion to int was successful
-            if (!okNodes || !okEdges) {
-                throw DijkstraException("File couldn't be parsed! First line is malformed.");
-            }
+    if (totalEdges > 0)
+    {
+        loadProgressDialog->setLabelText(QString("Adding edges: %1 of %2").arg(addedEdges).arg(totalEdges));
+    }
+    else
+    {
+        loadProgressDialog->setLabelText(QString("Parsing file: %1 of %2 MB").arg(parsedBytes >> 20).arg(totalBytes >> 20));
+    }
+}
 
-            nodesCount = nodes;
-            edgesCount = edges;
+void MainWindow::onGraphLoaded(Graph* loadedGraph)
+{
+    // A graph delivered while the window is destroyed is not shown anymore
+    if (isClosing)
+    {
+        delete loadedGraph;
+        return;
+    }
 
-            if (graph)
-            {
-                delete graph;
-            }
+    // The loaded graph replaces the current one at once, nothing refers to the old one after the swap
+    if (graph)
+    {
+        delete graph;
+    }
 
-            graph = new Graph(nodes, edges);
-            updateCurrentEdgeLabel(edges);
+    graph = loadedGraph;
+    nodesCount = graph->getCurrentNodeCount();
+    edgesCount = graph->getCurrentEdgeCount();
+    updateCurrentEdgeLabel(edgesCount);
 
-            // Read line by line, each line denotes an edge
-            while (!in.atEnd())
-            {
-                QStringList lineList = in.readLine().split(u',');
-                if (lineList.size() != 3)
-                {
-                    throw DijkstraException("File couldn't be parsed! One of the lines is malformed.");
-                }
-
-                bool okSource, okDestination, okWeight;
-                int source = lineList[0].toInt(&okSource);
-                int destination = lineList[1].toInt(&okDestination);
-                int weight = lineList[2].toInt(&okWeight);
-
-                // Check if conversion to int was successful
-                if (!okSource || !okDestination || !okWeight)
-                {
-                    throw DijkstraException("File couldn't be parsed! One of the lines is malformed.");
-                }
-                Edge* edge = new Edge(source, destination, weight);
-                graph->addEdge(edge);
-            }
+    ui->nodesCountText->clear();
+    ui->edgesCountText->clear();
+    ui->shortestPathLabel->setText("Shortest path: ");
+    ui->dijkstraSourceText->clear();
+    ui->dijkstraDestinationText->clear();
+    graphWidget->unHighlightAll();
+    updateGraphVisualization();
 
-            ui->nodesCountText->clear();
-            ui->edgesCountText->clear();
-            ui->shortestPathLabel->setText("Shortest path: ");
-            ui->dijkstraSourceText->clear();
-            ui->dijkstraDestinationText->clear();
-            graphWidget->unHighlightAll();
-            updateGraphVisualization();
-        }
-        catch (const std::exception& ex)
-        {
-            QMessageBox errorMessageBox;
-            errorMessageBox.critical(this, "Error", ex.what());
-            file.close();
-            return;
-        }
+    toggleCoreInput(false);
+    toggleEdgeInput(false);
+    toggleDijkstraInput(true);
+}
 
-        file.close();
+void MainWindow::onGraphLoadFailed(const QString& message)
+{
+    if (isClosing)
+        return;
+
+    QMessageBox errorMessageBox;
+    errorMessageBox.critical(this, "Error", message);
+}
+
+void MainWindow::onGraphLoadCanceled()
+{
+    if (graphLoader)
+    {
+        graphLoader->cancel();
     }
-    else
+}
+
+void MainWindow::onGraphLoadFinished()
+{
+    graphLoader = nullptr;
+
+    if (loadProgressDialog)
     {
-        QMessageBox errorMessageBox;
-        errorMessageBox.critical(this, "Error", "File could not be opened in the correct mode! Are you opening a .txt file?");
-        return;
+        loadProgressDialog->deleteLater();
+        loadProgressDialog = nullptr;
     }
 
-    toggleCoreInput(false);
-    toggleEdgeInput(false);
-    toggleDijkstraInput(true);
-    toggleSaveButton(true);
+    toggleOpenButton(true);
+    toggleSaveButton(graph != nullptr);
 }
 
 void MainWindow::connectInputSlots()
@@ -401,23 +467,43 @@ void MainWindow::populateEdgeList()
 {
     ui->edgeList->clear();
     int nodes = graph->getCurrentNodeCount();
-    for (int source = 0; source < nodes; source++)
+    int listedEdges = 0;
+    const CsrGraph& adjacency = graph->freeze();
+    for (int source = 0; source < nodes && listedEdges < MAXIMUM_LISTED_EDGE_COUNT; source++)
     {
-        Node* sourceHead = graph->head[source];
-        while (sourceHead != nullptr)
+        int edgeEnd = std::min(adjacency.getEdgeEnd(source), adjacency.getEdgeBegin(source) + MAXIMUM_LISTED_EDGE_COUNT - listedEdges);
+        listedEdges += edgeEnd - adjacency.getEdgeBegin(source);
+        for (int edge = adjacency.getEdgeBegin(source); edge < edgeEnd; edge++)
         {
-            int destination = sourceHead->getValue();
-            int weight = sourceHead->getCost();
+            int destination = adjacency.getTarget(edge);
+            int weight = adjacency.getWeight(edge);
             ui->edgeList->addItem(QString("%1 -> %2; Weight = %3").arg(QString::number(source), QString::number(destination), QString::number(weight)));
-            sourceHead = sourceHead->getNextNode();
         }
     }
 
+    if (adjacency.getEdgeCount() > listedEdges)
+    {
+        ui->edgeList->addItem(QString("... %1 more edges").arg(adjacency.getEdgeCount() - listedEdges));
+    }
+
     ui->edgeList->repaint();
 }
 
 MainWindow::~MainWindow()
 {
+    // A running load is cancelled and awaited, so it does not hand its graph to a destroyed window
+    if (graphLoader)
+    {
+        QThread* loaderThread = graphLoader->thread();
+        graphLoader->cancel();
+        loaderThread->quit();
+        loaderThread->wait();
+
+        // The loader may have delivered a graph before it noticed the cancellation, which is deleted by its slot
+        isClosing = true;
+        QCoreApplication::sendPostedEvents(this, QEvent::MetaCall);
+    }
+
     delete ui;
     delete graph;
     delete graphWidget;
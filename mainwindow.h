@@ -3,7 +3,9 @@
 
 #include "Graph.h"
 #include "GraphWidget.h"
+#include "GraphLoader.h"
 #include <QMainWindow>
+#include <QProgressDialog>
 
 QT_BEGIN_NAMESPACE
 namespace Ui { class MainWindow; }
@@ -75,6 +77,33 @@ private slots:
      */
     void on_openButton_clicked();
 
+    /*!
+     * Slot, connected to the progress of the graph loader, updates the progress dialog.
+     * \param parsedBytes The count of parsed bytes.
+     * \param totalBytes The size of the file.
+     * \param addedEdges The count of edges added to the graph so far.
+     * \param totalEdges The count of edges to be added, 0 while the file is parsed.
+     */
+    void onGraphLoadProgressChanged(qint64 parsedBytes, qint64 totalBytes, qint64 addedEdges, qint64 totalEdges);
+    /*!
+     * Slot, executed when the graph loader has loaded a graph, which replaces the current one.
+     * \param loadedGraph The loaded graph.
+     */
+    void onGraphLoaded(Graph* loadedGraph);
+    /*!
+     * Slot, executed when the graph loader could not load the file.
+     * \param message The error's message.
+     */
+    void onGraphLoadFailed(const QString& message);
+    /*!
+     * Slot, executed when the cancel button of the progress dialog is clicked.
+     */
+    void onGraphLoadCanceled();
+    /*!
+     * Slot, executed when the graph loader has finished in any way.
+     */
+    void onGraphLoadFinished();
+
 private:
     Ui::MainWindow *ui;
     /*!
@@ -90,6 +119,25 @@ private:
 
     Graph *graph;
 
+    /*!
+     * The loader of the file being opened, nullptr if no file is being opened.
+     */
+    GraphLoader *graphLoader;
+    QProgressDialog *loadProgressDialog;
+    /*!
+     * The maximum value of the progress dialog and the time before it is shown, so short loads do not flash it.
+     */
+    static const int LOAD_PROGRESS_MAXIMUM = 1000;
+    static const int LOAD_PROGRESS_DELAY_MS = 500;
+    /*!
+     * The count of edges, up to which the edge list shows the edges, a list of a large graph would block the GUI thread.
+     */
+    static const int MAXIMUM_LISTED_EDGE_COUNT = 10000;
+    /*!
+     * Whether the window is being destroyed, a graph delivered by a load, which finished meanwhile, is then only deleted.
+     */
+    bool isClosing;
+
     /*!
      * Sets the validation of the input line edits.
      */
@@ -124,10 +172,20 @@ private:
     void updateGraphVisualization();
 
     /*!
-     * Pushes all edges (with their weights) to an QListWidget in the UI
-     * in case two weights are overlapping on the graph visualization
+     * Pushes the edges (with their weights) to an QListWidget in the UI
+     * in case two weights are overlapping on the graph visualization,
+     * up to MAXIMUM_LISTED_EDGE_COUNT edges, followed by the count of the remaining ones
      */
     void populateEdgeList();
+
+    /*!
+     * Returns the information about a shortest path, which is shown in the UI
+     * \param source The source node
+     * \param destination The destination node
+     * \param path The shortest path from source to destination
+     * \return The path's description
+     */
+    QString composePathMessage(int source, int destination, const ShortestPathResult& path) const;
 };
 
 #endif // MAINWINDOW_H